@@ -7,6 +7,7 @@
 #pragma once
 
 #include <algorithm>
+#include <string>
 
 #include "../core/logging.h"
 #include "../core/carlLogging.h"
@@ -150,6 +151,8 @@ public:
 	PolynomialComparisonOrder order;
 	/// standard strategy to be used for real root isolation
 	rootfinder::SplittingStrategy splittingStrategy;
+	/// number of threads computing the resultants and discriminants of one elimination step (only used if carl is built with THREAD_SAFE)
+	std::size_t projectionThreads;
 
 	/**
 	 * Generate a CADSettings instance of the respective preset type.
@@ -250,6 +253,8 @@ public:
 			settingStrs.push_back( "Given bounds to the check method, these bounds are used to cancel out elimination polynomials." );
 		if (settings.improveBounds)
 			settingStrs.push_back( "Given bounds to the check method, the bounds are widened after determining unsatisfiability by check, or shrunk after determining satisfiability by check." );
+		if (settings.projectionThreads > 1)
+			settingStrs.push_back( "Compute the projection of every elimination step with " + std::to_string(settings.projectionThreads) + " threads." );
 		std::string orderStr = "Polynomial order: ";
 
 		if (settings.order == PolynomialComparisonOrder::CauchyBound)
@@ -293,7 +298,8 @@ private:
 		ignoreRoots(false),
 		integerHandling(IntegerHandling::SPLIT_ASSIGNMENT),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		projectionThreads(1)
 	{}
 
 public:
@@ -319,7 +325,8 @@ public:
 		ignoreRoots(s.ignoreRoots),
 		integerHandling(s.integerHandling),
 		order(PolynomialComparisonOrder::Default),
-		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT)
+		splittingStrategy(rootfinder::SplittingStrategy::DEFAULT),
+		projectionThreads(s.projectionThreads)
 	{}
 };
 
@@ -13,6 +13,7 @@
 #include <utility>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "../util/pointerOperations.h"
 #include "../core/UnivariatePolynomial.h"
@@ -145,6 +146,20 @@ private:
 	void project(Args&&... args) const {
 		projection(projectionType, std::forward<Args>(args)...);
 	}
+	/**
+	 * A projection job: a pair of polynomials for paired elimination or a polynomial and nullptr for single elimination.
+	 */
+	typedef std::pair<const UPolynomial*, const UPolynomial*> ProjectionJob;
+	/**
+	 * Computes the projections for all jobs and inserts the results into destination.
+	 * The jobs are independent and are distributed to setting.projectionThreads threads if carl is built with THREAD_SAFE.
+	 * The results are inserted in the order of the jobs, hence the outcome does not depend on the timing of the threads.
+	 * @param jobs
+	 * @param variable the main variable of the destination elimination set
+	 * @param destination
+	 * @param setting
+	 */
+	void projectInto(const std::vector<ProjectionJob>& jobs, Variable::Arg variable, EliminationSet<Coefficient>& destination, const CADSettings& setting) const;
 
 	/**
 	 * Elimination queue containing all polynomials not yet considered for non-paired elimination.
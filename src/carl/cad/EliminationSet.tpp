@@ -6,8 +6,14 @@
 #include "EliminationSet.h"
 #include "CADLogging.h"
 
+#include "../core/polynomialfunctions/Factorization.h"
 #include "../core/polynomialfunctions/SquareFreePart.h"
 
+#ifdef THREAD_SAFE
+#include <atomic>
+#include <thread>
+#endif
+
 namespace carl {
 namespace cad {
 
@@ -293,6 +299,34 @@ const typename EliminationSet<Coefficient>::UPolynomial* EliminationSet<Coeffici
 	return p;
 }
 
+template<typename Coefficient>
+void EliminationSet<Coefficient>::projectInto(const std::vector<ProjectionJob>& jobs, Variable::Arg variable, EliminationSet<Coefficient>& destination, const CADSettings& setting) const {
+	std::vector<ProjectionRecorder<UPolynomial>> results(jobs.size());
+	auto run = [&](std::size_t job) {
+		if (jobs[job].second == nullptr) {
+			project(jobs[job].first, variable, results[job]);
+		} else {
+			project(jobs[job].first, jobs[job].second, variable, results[job]);
+		}
+	};
+#ifdef THREAD_SAFE
+	if (setting.projectionThreads > 1 && jobs.size() > 1) {
+		std::atomic<std::size_t> next(0);
+		std::vector<std::thread> workers;
+		for (std::size_t t = 0; t < std::min(setting.projectionThreads, jobs.size()); t++) {
+			workers.emplace_back([&](){
+				for (std::size_t job = next++; job < jobs.size(); job = next++) run(job);
+			});
+		}
+		for (auto& w: workers) w.join();
+		for (const auto& r: results) r.replay(destination);
+		return;
+	}
+#endif
+	for (std::size_t job = 0; job < jobs.size(); job++) run(job);
+	for (const auto& r: results) r.replay(destination);
+}
+
 template<typename Coefficient>
 std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationSet<Coefficient>::eliminateInto(
 		const UPolynomial* p,
@@ -327,6 +361,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	}
 
 	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+	std::vector<ProjectionJob> jobs;
 
 	// PAIRED elimination with the new polynomials: (1) together with the existing ones (2) among themselves
 
@@ -335,7 +370,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 		for (auto pol_it1: this->polynomials) {
 			assert(p->mainVar() == pol_it1->mainVar());
 			//eliminationEq( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
+			jobs.emplace_back(p, pol_it1);
 		}
 		// (2) elimination with polynomial itself @todo: proof that we do not need that
 		// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
@@ -344,7 +379,7 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 		for (auto pol_it1: this->polynomials) {
 			assert(p->mainVar() == pol_it1->mainVar());
 			//elimination( p, pol_it1, variable, newEliminationPolynomials, false );
-			project(p, pol_it1, variable, newEliminationPolynomials);
+			jobs.emplace_back(p, pol_it1);
 		}
 		// (2) elimination with polynomial itself @todo: proof that we do not need that
 		// elimination( p, p, variable, newEliminationPolynomials, setting );
@@ -355,11 +390,12 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 
 	if( setting.equationsOnly ) {
 		//eliminationEq( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
+		jobs.emplace_back(p, nullptr);
 	} else {
 		//elimination( p, variable, newEliminationPolynomials, false );
-		project(p, variable, newEliminationPolynomials);
+		jobs.emplace_back(p, nullptr);
 	}
+	projectInto(jobs, variable, newEliminationPolynomials, setting);
 
 
 	// optimizations
@@ -431,19 +467,20 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 	}
 
 	EliminationSet<Coefficient> newEliminationPolynomials(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
+	std::vector<ProjectionJob> jobs;
 
 	// PAIRED elimination with the new polynomials: (1) together with the existing ones (2) among themselves
 	if (!mPairedEliminationQueue.empty()) {
 		if( setting.equationsOnly ) {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				jobs.emplace_back(p, pol_it1);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// eliminationEq( p, p, variable, newEliminationPolynomials, setting );
 		} else {
 			// (1) elimination with existing polynomials
 			for (auto pol_it1: this->polynomials)
-				project( p, pol_it1, variable, newEliminationPolynomials);
+				jobs.emplace_back(p, pol_it1);
 			// (2) elimination with polynomial itself @todo: proof that we do not need that
 			// elimination( p, p, variable, newEliminationPolynomials, setting );
 		}
@@ -455,13 +492,10 @@ std::list<const typename EliminationSet<Coefficient>::UPolynomial*> EliminationS
 			( ( !synchronous || p == mSingleEliminationQueue.front() ) || mPairedEliminationQueue.empty() ) )
 	{
 		p = mSingleEliminationQueue.front();
-		if (setting.equationsOnly) {
-			project( p, variable, newEliminationPolynomials );
-		} else {
-			project( p, variable, newEliminationPolynomials );
-		}
+		jobs.emplace_back(p, nullptr);
 		mSingleEliminationQueue.pop_front();
 	}
+	projectInto(jobs, variable, newEliminationPolynomials, setting);
 
 	// optimizations
 	if( setting.simplifyByFactorization )
@@ -563,11 +597,16 @@ void EliminationSet<Coefficient>::factorize() {
 	EliminationSet<Coefficient> factorizedSet(this->polynomialOwner, this->liftingOrder, this->eliminationOrder);
 	for (auto p: this->polynomials) {
 		// insert the factors and omit the original
-		// TODO: Perform multivariate factorization here.
-		/*for (auto factor: p->factorization()) {
-			factorizedSet.insert(factor.first, this->getParentsOf(p));
-		}*/
-		factorizedSet.insert(p, this->getParentsOf(p));
+		// factors without the main variable are dropped, just like the content by makePrimitive()
+		bool inserted = false;
+		for (const auto& factor: carl::factorization(MPolynomial<Coefficient>(*p))) {
+			if (!factor.first.has(p->mainVar())) continue;
+			UPolynomial f = factor.first.toUnivariatePolynomial(p->mainVar());
+			DOT_EDGE("elimination", p, f, "label=\"factor\"");
+			factorizedSet.insert(f, this->getParentsOf(p));
+			inserted = true;
+		}
+		if (!inserted) factorizedSet.insert(p, this->getParentsOf(p));
 	}
 	std::swap(*this, factorizedSet);
 }
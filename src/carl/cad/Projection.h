@@ -5,6 +5,10 @@
 
 #include "../core/polynomialfunctions/Resultant.h"
 
+#include <list>
+#include <tuple>
+#include <vector>
+
 namespace carl {
 namespace cad {
 
@@ -12,6 +16,26 @@ namespace cad {
         Brown, McCallum, Hong
     };
 
+    /**
+     * Inserter that records the polynomials produced by a projection operator.
+     * This allows to compute projections concurrently and to insert the results afterwards in a deterministic order.
+     */
+    template<typename UPoly>
+    struct ProjectionRecorder {
+        std::vector<std::tuple<UPoly, std::list<const UPoly*>, bool>> results;
+
+        void insert(const UPoly& p, const std::list<const UPoly*>& parents, bool avoidSingle) {
+            results.emplace_back(p, parents, avoidSingle);
+        }
+        /// Inserts all recorded polynomials into the given inserter, in the order they were recorded.
+        template<typename Inserter>
+        void replay(Inserter& i) const {
+            for (const auto& r: results) {
+                i.insert(std::get<0>(r), std::get<1>(r), std::get<2>(r));
+            }
+        }
+    };
+
     template<typename Poly>
     struct ProjectionOperator {
         template<typename Inserter>
@@ -0,0 +1,344 @@
+/**
+ * @file   AdaptiveCoefficients.h
+ * @ingroup unirp
+ *
+ * Coefficient storage of univariate polynomials that switches between a dense and a sparse representation.
+ * Polynomials like \f$x^{1000} - 2\f$ only store their nonzero terms, while polynomials with many nonzero coefficients
+ * keep the dense vector that most algorithms operate on.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Coefficients of a univariate polynomial, stored either densely or as a list of nonzero terms.
+ *
+ * The interface resembles `std::vector<Coefficient>`, indexed by the exponent, such that dense algorithms work unchanged.
+ * Any access to the dense vector, except for the size and the leading coefficient, converts a sparse representation to the dense one.
+ * Conversions in const member functions keep the sparse terms alive, hence references to the leading coefficient stay valid.
+ * Sparse representations are only created by the constructors of UnivariatePolynomial and the arithmetic operations that handle them explicitly.
+ * As the conversions are not synchronized, the sparse representation is disabled if carl is built with THREAD_SAFE.
+ */
+template<typename Coefficient>
+class AdaptiveCoefficients
+{
+public:
+	using Dense = std::vector<Coefficient>;
+	/// Nonzero coefficient together with its exponent.
+	using Term = std::pair<std::size_t, Coefficient>;
+	/// Nonzero terms, sorted by increasing exponent.
+	using Sparse = std::vector<Term>;
+
+	using value_type = Coefficient;
+	using size_type = std::size_t;
+	using reference = typename Dense::reference;
+	using const_reference = typename Dense::const_reference;
+	using iterator = typename Dense::iterator;
+	using const_iterator = typename Dense::const_iterator;
+	using reverse_iterator = typename Dense::reverse_iterator;
+	using const_reverse_iterator = typename Dense::const_reverse_iterator;
+
+#ifdef THREAD_SAFE
+	static constexpr bool enabled = false;
+#else
+	static constexpr bool enabled = true;
+#endif
+	/// Polynomials of smaller degree are always stored densely.
+	static constexpr std::size_t min_size = 64;
+	/// The sparse representation is used if at most one in this many coefficients is nonzero.
+	static constexpr std::size_t density = 8;
+
+	/// Checks whether the sparse representation is preferred for the given number of terms and dense size.
+	static bool preferSparse(std::size_t terms, std::size_t size) {
+		return enabled && size >= min_size && terms * density <= size;
+	}
+
+private:
+	mutable Dense mDense;
+	mutable Sparse mSparse;
+	mutable bool mIsSparse = false;
+
+	/// Creates the dense vector from the sparse terms, keeping the terms.
+	void densify() const {
+		if (!mIsSparse) return;
+		assert(mDense.empty());
+		if (!mSparse.empty()) {
+			mDense.resize(mSparse.back().first + 1, Coefficient(0));
+			for (const auto& t: mSparse) mDense[t.first] = t.second;
+		}
+		mIsSparse = false;
+	}
+	/// Switches to the dense representation before a modification.
+	void makeDense() {
+		densify();
+		if (!mSparse.empty()) Sparse().swap(mSparse);
+	}
+
+public:
+	AdaptiveCoefficients() = default;
+	AdaptiveCoefficients(std::size_t size, const Coefficient& c): mDense(size, c) {}
+	AdaptiveCoefficients(std::initializer_list<Coefficient> coefficients): mDense(coefficients) {}
+	AdaptiveCoefficients(const Dense& coefficients): mDense(coefficients) {}
+	AdaptiveCoefficients(Dense&& coefficients): mDense(std::move(coefficients)) {}
+	AdaptiveCoefficients(const AdaptiveCoefficients& c): mDense(c.mDense), mSparse(c.mIsSparse ? c.mSparse : Sparse()), mIsSparse(c.mIsSparse) {}
+	AdaptiveCoefficients(AdaptiveCoefficients&& c) noexcept: mDense(std::move(c.mDense)), mSparse(std::move(c.mSparse)), mIsSparse(c.mIsSparse) {
+		c.mDense.clear();
+		c.mSparse.clear();
+		c.mIsSparse = false;
+	}
+	AdaptiveCoefficients& operator=(const AdaptiveCoefficients& c) {
+		if (this == &c) return *this;
+		mDense = c.mDense;
+		mSparse = c.mIsSparse ? c.mSparse : Sparse();
+		mIsSparse = c.mIsSparse;
+		return *this;
+	}
+	AdaptiveCoefficients& operator=(AdaptiveCoefficients&& c) noexcept {
+		if (this == &c) return *this;
+		mDense = std::move(c.mDense);
+		mSparse = std::move(c.mSparse);
+		mIsSparse = c.mIsSparse;
+		c.mDense.clear();
+		c.mSparse.clear();
+		c.mIsSparse = false;
+		return *this;
+	}
+	AdaptiveCoefficients& operator=(const Dense& coefficients) {
+		mDense = coefficients;
+		Sparse().swap(mSparse);
+		mIsSparse = false;
+		return *this;
+	}
+	AdaptiveCoefficients& operator=(Dense&& coefficients) {
+		mDense = std::move(coefficients);
+		Sparse().swap(mSparse);
+		mIsSparse = false;
+		return *this;
+	}
+
+	/// @name Representation
+	/// @{
+	bool isSparse() const {
+		return mIsSparse;
+	}
+	/// Returns the nonzero terms, sorted by increasing exponent.
+	Sparse terms() const {
+		if (mIsSparse) return mSparse;
+		Sparse res;
+		for (std::size_t i = 0; i < mDense.size(); i++) {
+			if (mDense[i] != Coefficient(0)) res.emplace_back(i, mDense[i]);
+		}
+		return res;
+	}
+	/**
+	 * Replaces the coefficients by the given terms and chooses the representation by their density.
+	 * @param terms Nonzero terms, sorted by increasing exponent.
+	 */
+	void assignTerms(Sparse&& terms) {
+		assert(std::is_sorted(terms.begin(), terms.end(), [](const Term& a, const Term& b){ return a.first < b.first; }));
+		mDense.clear();
+		if (!terms.empty() && preferSparse(terms.size(), terms.back().first + 1)) {
+			mSparse = std::move(terms);
+			mIsSparse = true;
+			return;
+		}
+		Sparse().swap(mSparse);
+		mIsSparse = false;
+		if (terms.empty()) return;
+		mDense.resize(terms.back().first + 1, Coefficient(0));
+		for (auto& t: terms) mDense[t.first] = std::move(t.second);
+	}
+	/// Switches to the sparse representation, if it is preferred for the current coefficients.
+	void adapt() {
+		if (mIsSparse || !enabled || mDense.size() < min_size) return;
+		std::size_t nonzero = 0;
+		for (const auto& c: mDense) {
+			if (c != Coefficient(0)) nonzero++;
+		}
+		if (!preferSparse(nonzero, mDense.size())) return;
+		mSparse = terms();
+		Dense().swap(mDense);
+		mIsSparse = true;
+	}
+	const Dense& dense() const {
+		densify();
+		return mDense;
+	}
+	Dense& dense() {
+		makeDense();
+		return mDense;
+	}
+	operator const Dense&() const {
+		return dense();
+	}
+	/// @}
+
+	/// @name Vector interface
+	/// @{
+	std::size_t size() const {
+		if (mIsSparse) return mSparse.empty() ? 0 : mSparse.back().first + 1;
+		return mDense.size();
+	}
+	bool empty() const {
+		return size() == 0;
+	}
+	const Coefficient& back() const {
+		if (mIsSparse) return mSparse.back().second;
+		return mDense.back();
+	}
+	Coefficient& back() {
+		return dense().back();
+	}
+	const Coefficient& front() const {
+		if (mIsSparse && mSparse.front().first == 0) return mSparse.front().second;
+		return dense().front();
+	}
+	Coefficient& front() {
+		return dense().front();
+	}
+	const Coefficient& operator[](std::size_t i) const {
+		return dense()[i];
+	}
+	Coefficient& operator[](std::size_t i) {
+		return dense()[i];
+	}
+	const_iterator begin() const { return dense().begin(); }
+	const_iterator end() const { return dense().end(); }
+	iterator begin() { return dense().begin(); }
+	iterator end() { return dense().end(); }
+	const_reverse_iterator rbegin() const { return dense().rbegin(); }
+	const_reverse_iterator rend() const { return dense().rend(); }
+	reverse_iterator rbegin() { return dense().rbegin(); }
+	reverse_iterator rend() { return dense().rend(); }
+
+	void clear() {
+		mDense.clear();
+		Sparse().swap(mSparse);
+		mIsSparse = false;
+	}
+	void reserve(std::size_t n) {
+		if (!mIsSparse) mDense.reserve(n);
+	}
+	void shrink_to_fit() {
+		if (!mIsSparse) mDense.shrink_to_fit();
+	}
+	void resize(std::size_t n) { dense().resize(n); }
+	void resize(std::size_t n, const Coefficient& c) { dense().resize(n, c); }
+	void push_back(const Coefficient& c) { dense().push_back(c); }
+	void push_back(Coefficient&& c) { dense().push_back(std::move(c)); }
+	template<typename... Args>
+	void emplace_back(Args&&... args) { dense().emplace_back(std::forward<Args>(args)...); }
+	void pop_back() { dense().pop_back(); }
+	template<typename... Args>
+	iterator insert(const_iterator pos, Args&&... args) {
+		return dense().insert(pos, std::forward<Args>(args)...);
+	}
+	iterator erase(const_iterator first, const_iterator last) {
+		return dense().erase(first, last);
+	}
+	template<typename... Args>
+	void assign(Args&&... args) {
+		dense().assign(std::forward<Args>(args)...);
+	}
+	void swap(Dense& coefficients) {
+		dense().swap(coefficients);
+	}
+	void swap(AdaptiveCoefficients& c) {
+		std::swap(*this, c);
+	}
+	/// @}
+
+	friend bool operator==(const AdaptiveCoefficients& lhs, const AdaptiveCoefficients& rhs) {
+		if (lhs.mIsSparse && rhs.mIsSparse) return lhs.mSparse == rhs.mSparse;
+		if (lhs.size() != rhs.size()) return false;
+		return lhs.dense() == rhs.dense();
+	}
+	friend bool operator!=(const AdaptiveCoefficients& lhs, const AdaptiveCoefficients& rhs) {
+		return !(lhs == rhs);
+	}
+};
+
+namespace sparse_univariate
+{
+	template<typename Coefficient>
+	using Terms = std::vector<std::pair<std::size_t, Coefficient>>;
+
+	/// Computes \f$base^{exp}\f$ by repeated squaring.
+	template<typename Coefficient>
+	Coefficient power(const Coefficient& base, std::size_t exp) {
+		Coefficient res(1);
+		Coefficient b = base;
+		while (exp > 0) {
+			if ((exp & 1) != 0) res *= b;
+			exp /= 2;
+			if (exp > 0) b *= b;
+		}
+		return res;
+	}
+
+	template<typename Coefficient>
+	Terms<Coefficient> add(const Terms<Coefficient>& a, const Terms<Coefficient>& b) {
+		Terms<Coefficient> res;
+		res.reserve(a.size() + b.size());
+		auto ita = a.begin();
+		auto itb = b.begin();
+		while (ita != a.end() || itb != b.end()) {
+			if (itb == b.end() || (ita != a.end() && ita->first < itb->first)) {
+				res.push_back(*ita++);
+			} else if (ita == a.end() || itb->first < ita->first) {
+				res.push_back(*itb++);
+			} else {
+				Coefficient c = ita->second + itb->second;
+				if (c != Coefficient(0)) res.emplace_back(ita->first, std::move(c));
+				++ita;
+				++itb;
+			}
+		}
+		return res;
+	}
+
+	/// Multiplies term by term and merges the products with equal exponents.
+	template<typename Coefficient>
+	Terms<Coefficient> multiply(const Terms<Coefficient>& a, const Terms<Coefficient>& b) {
+		Terms<Coefficient> products;
+		products.reserve(a.size() * b.size());
+		for (const auto& ta: a) {
+			for (const auto& tb: b) products.emplace_back(ta.first + tb.first, ta.second * tb.second);
+		}
+		std::stable_sort(products.begin(), products.end(), [](const auto& l, const auto& r){ return l.first < r.first; });
+		Terms<Coefficient> res;
+		for (auto& t: products) {
+			if (!res.empty() && res.back().first == t.first) res.back().second += t.second;
+			else {
+				if (!res.empty() && res.back().second == Coefficient(0)) res.pop_back();
+				res.push_back(std::move(t));
+			}
+		}
+		if (!res.empty() && res.back().second == Coefficient(0)) res.pop_back();
+		return res;
+	}
+
+	/// Evaluates the terms at the given point, computing the powers of the point only for the gaps between the exponents.
+	template<typename Coefficient>
+	Coefficient evaluate(const Terms<Coefficient>& a, const Coefficient& value) {
+		Coefficient res(0);
+		Coefficient pow(1);
+		std::size_t exp = 0;
+		for (const auto& t: a) {
+			pow *= power(value, t.first - exp);
+			exp = t.first;
+			res += t.second * pow;
+		}
+		return res;
+	}
+}
+
+}
@@ -0,0 +1,336 @@
+/**
+ * @file   ModularArithmetic.h
+ * @ingroup gcd
+ * @ingroup multirp
+ *
+ * Arithmetic on dense univariate and sparse multivariate polynomials over \f$Z_p\f$ for word-sized primes,
+ * shared by the modular gcd and resultant computations.
+ */
+
+#pragma once
+
+#include "Monomial.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace carl
+{
+namespace modular_gcd
+{
+	/// Dense exponent vector, indexed by the position of the variable.
+	using Exponents = std::vector<exponent>;
+	/// Sparse polynomial over \f$Z_p\f$, ordered lexicographically on the exponent vectors.
+	using ModPolynomial = std::map<Exponents, std::uint64_t>;
+	/// Dense univariate polynomial over \f$Z_p\f$, index i holds the coefficient of \f$x^i\f$.
+	using ModUnivariate = std::vector<std::uint64_t>;
+	/// Polynomial grouped by the last variable: maps the remaining exponents to a univariate polynomial in the last variable.
+	using ModGrouped = std::map<Exponents, ModUnivariate>;
+
+	/// Primes are kept below 2^31 such that products fit into 64 bits.
+	constexpr std::uint64_t max_prime = (std::uint64_t(1) << 31) - 1;
+
+	inline std::uint64_t mulmod(std::uint64_t a, std::uint64_t b, std::uint64_t p) {
+		return (a * b) % p;
+	}
+	inline std::uint64_t addmod(std::uint64_t a, std::uint64_t b, std::uint64_t p) {
+		std::uint64_t r = a + b;
+		return r >= p ? r - p : r;
+	}
+	inline std::uint64_t submod(std::uint64_t a, std::uint64_t b, std::uint64_t p) {
+		return a >= b ? a - b : a + p - b;
+	}
+	inline std::uint64_t powmod(std::uint64_t a, std::uint64_t e, std::uint64_t p) {
+		std::uint64_t res = 1;
+		while (e > 0) {
+			if (e & 1) res = mulmod(res, a, p);
+			a = mulmod(a, a, p);
+			e >>= 1;
+		}
+		return res;
+	}
+	/// Inverse modulo a prime via Fermat's little theorem.
+	inline std::uint64_t invmod(std::uint64_t a, std::uint64_t p) {
+		assert(a % p != 0);
+		return powmod(a, p - 2, p);
+	}
+	inline bool isPrime(std::uint64_t n) {
+		if (n < 2) return false;
+		if (n % 2 == 0) return n == 2;
+		for (std::uint64_t d = 3; d * d <= n; d += 2) {
+			if (n % d == 0) return false;
+		}
+		return true;
+	}
+	/// Returns the largest prime smaller than n.
+	inline std::uint64_t previousPrime(std::uint64_t n) {
+		for (--n; n > 2; --n) {
+			if (isPrime(n)) return n;
+		}
+		return 2;
+	}
+
+	/// @name Dense univariate arithmetic over Z_p
+	/// @{
+	inline void strip(ModUnivariate& u) {
+		while (!u.empty() && u.back() == 0) u.pop_back();
+	}
+	inline std::uint64_t evaluate(const ModUnivariate& u, std::uint64_t a, std::uint64_t p) {
+		std::uint64_t res = 0;
+		for (auto it = u.rbegin(); it != u.rend(); ++it) {
+			res = addmod(mulmod(res, a, p), *it, p);
+		}
+		return res;
+	}
+	inline ModUnivariate multiply(const ModUnivariate& a, const ModUnivariate& b, std::uint64_t p) {
+		if (a.empty() || b.empty()) return ModUnivariate();
+		ModUnivariate res(a.size() + b.size() - 1, 0);
+		for (std::size_t i = 0; i < a.size(); i++) {
+			if (a[i] == 0) continue;
+			for (std::size_t j = 0; j < b.size(); j++) {
+				res[i+j] = addmod(res[i+j], mulmod(a[i], b[j], p), p);
+			}
+		}
+		return res;
+	}
+	inline ModUnivariate scale(const ModUnivariate& a, std::uint64_t c, std::uint64_t p) {
+		ModUnivariate res(a);
+		for (auto& r: res) r = mulmod(r, c, p);
+		strip(res);
+		return res;
+	}
+	inline void addTo(ModUnivariate& a, const ModUnivariate& b, std::uint64_t p) {
+		if (a.size() < b.size()) a.resize(b.size(), 0);
+		for (std::size_t i = 0; i < b.size(); i++) a[i] = addmod(a[i], b[i], p);
+		strip(a);
+	}
+	/**
+	 * Divides a by b, stores the remainder in a and returns the quotient.
+	 */
+	inline ModUnivariate divide(ModUnivariate& a, const ModUnivariate& b, std::uint64_t p) {
+		assert(!b.empty());
+		if (a.size() < b.size()) return ModUnivariate();
+		ModUnivariate q(a.size() - b.size() + 1, 0);
+		std::uint64_t inv = invmod(b.back(), p);
+		for (std::size_t i = a.size(); i >= b.size(); i--) {
+			std::uint64_t c = mulmod(a[i-1], inv, p);
+			if (c == 0) continue;
+			std::size_t shift = i - b.size();
+			q[shift] = c;
+			for (std::size_t j = 0; j < b.size(); j++) {
+				a[shift+j] = submod(a[shift+j], mulmod(c, b[j], p), p);
+			}
+		}
+		strip(a);
+		return q;
+	}
+	inline ModUnivariate monic(const ModUnivariate& a, std::uint64_t p) {
+		if (a.empty()) return a;
+		return scale(a, invmod(a.back(), p), p);
+	}
+	/// Computes the monic gcd of a and b by the euclidean algorithm.
+	inline ModUnivariate gcd(ModUnivariate a, ModUnivariate b, std::uint64_t p) {
+		while (!b.empty()) {
+			divide(a, b, p);
+			std::swap(a, b);
+		}
+		return monic(a, p);
+	}
+	/// @}
+
+	/// @name Sparse multivariate arithmetic over Z_p
+	/// @{
+	inline void addTerm(ModPolynomial& p, const Exponents& e, std::uint64_t c, std::uint64_t prime) {
+		if (c == 0) return;
+		auto it = p.find(e);
+		if (it == p.end()) {
+			p.emplace(e, c);
+		} else {
+			it->second = addmod(it->second, c, prime);
+			if (it->second == 0) p.erase(it);
+		}
+	}
+	inline ModPolynomial scale(const ModPolynomial& a, std::uint64_t c, std::uint64_t p) {
+		ModPolynomial res;
+		if (c == 0) return res;
+		for (const auto& t: a) res.emplace_hint(res.end(), t.first, mulmod(t.second, c, p));
+		return res;
+	}
+	inline ModPolynomial monic(const ModPolynomial& a, std::uint64_t p) {
+		if (a.empty()) return a;
+		return scale(a, invmod(a.rbegin()->second, p), p);
+	}
+	/// Substitutes the last variable by a, removing it from the exponent vectors.
+	inline ModPolynomial evaluateLast(const ModPolynomial& a, std::uint64_t val, std::uint64_t p) {
+		ModPolynomial res;
+		std::vector<std::uint64_t> powers(1, 1);
+		for (const auto& t: a) {
+			exponent e = t.first.back();
+			while (powers.size() <= e) powers.push_back(mulmod(powers.back(), val, p));
+			addTerm(res, Exponents(t.first.begin(), t.first.end() - 1), mulmod(t.second, powers[e], p), p);
+		}
+		return res;
+	}
+	inline ModGrouped groupByLast(const ModPolynomial& a) {
+		ModGrouped res;
+		for (const auto& t: a) {
+			auto& u = res[Exponents(t.first.begin(), t.first.end() - 1)];
+			exponent e = t.first.back();
+			if (u.size() <= e) u.resize(e + 1, 0);
+			u[e] = t.second;
+		}
+		return res;
+	}
+	inline ModPolynomial ungroup(const ModGrouped& a) {
+		ModPolynomial res;
+		for (const auto& g: a) {
+			Exponents e(g.first);
+			e.push_back(0);
+			for (std::size_t i = 0; i < g.second.size(); i++) {
+				if (g.second[i] == 0) continue;
+				e.back() = exponent(i);
+				res.emplace(e, g.second[i]);
+			}
+		}
+		return res;
+	}
+	/// Computes the content with respect to all but the last variable, i.e. the gcd of all groups.
+	inline ModUnivariate contentLast(const ModGrouped& a, std::uint64_t p) {
+		ModUnivariate res;
+		for (const auto& g: a) {
+			res = gcd(res, g.second, p);
+			if (res.size() == 1) break;
+		}
+		return res;
+	}
+	inline void divideGroups(ModGrouped& a, const ModUnivariate& d, std::uint64_t p) {
+		if (d.size() == 1) return;
+		for (auto& g: a) {
+			g.second = divide(g.second, d, p);
+		}
+	}
+	inline std::size_t degreeLast(const ModGrouped& a) {
+		std::size_t res = 0;
+		for (const auto& g: a) res = std::max(res, g.second.size() - 1);
+		return res;
+	}
+	/// Checks whether d divides a by means of multivariate division in lexicographic order.
+	inline bool divides(const ModPolynomial& a, const ModPolynomial& d, std::uint64_t p) {
+		assert(!d.empty());
+		ModPolynomial r(a);
+		const Exponents& lm = d.rbegin()->first;
+		std::uint64_t inv = invmod(d.rbegin()->second, p);
+		while (!r.empty()) {
+			auto lt = *r.rbegin();
+			Exponents q(lm.size());
+			for (std::size_t i = 0; i < lm.size(); i++) {
+				if (lt.first[i] < lm[i]) return false;
+				q[i] = lt.first[i] - lm[i];
+			}
+			std::uint64_t c = p - mulmod(lt.second, inv, p);
+			for (const auto& t: d) {
+				Exponents e(q);
+				for (std::size_t i = 0; i < e.size(); i++) e[i] += t.first[i];
+				addTerm(r, e, mulmod(c, t.second, p), p);
+			}
+		}
+		return true;
+	}
+	/// @}
+
+	/**
+	 * Computes the monic gcd of two nonzero polynomials over \f$Z_p\f$ in n variables.
+	 * Implements the recursive evaluation and interpolation scheme of @cite GCL92, Algorithm 7.2.
+	 * @param a First polynomial.
+	 * @param b Second polynomial.
+	 * @param n Number of variables.
+	 * @param p Prime.
+	 * @param res Resulting gcd.
+	 * @return false if we ran out of evaluation points.
+	 */
+	inline bool gcd(const ModPolynomial& a, const ModPolynomial& b, std::size_t n, std::uint64_t p, ModPolynomial& res) {
+		assert(!a.empty() && !b.empty());
+		if (n == 0) {
+			res = ModPolynomial({{Exponents(), 1}});
+			return true;
+		}
+		ModGrouped ga = groupByLast(a);
+		ModGrouped gb = groupByLast(b);
+		if (n == 1) {
+			ModUnivariate g = gcd(ga.begin()->second, gb.begin()->second, p);
+			res = ungroup(ModGrouped({{Exponents(), g}}));
+			return true;
+		}
+		ModUnivariate ca = contentLast(ga, p);
+		ModUnivariate cb = contentLast(gb, p);
+		ModUnivariate c = gcd(ca, cb, p);
+		divideGroups(ga, ca, p);
+		divideGroups(gb, cb, p);
+		const ModUnivariate& lca = ga.rbegin()->second;
+		const ModUnivariate& lcb = gb.rbegin()->second;
+		ModUnivariate g = gcd(lca, lcb, p);
+		std::size_t bound = std::min(degreeLast(ga), degreeLast(gb)) + g.size() - 1;
+		ModPolynomial ppa = ungroup(ga);
+		ModPolynomial ppb = ungroup(gb);
+
+		ModGrouped interpolant;
+		ModUnivariate product({1});
+		Exponents leading;
+		std::size_t points = 0;
+		for (std::uint64_t val = 0; val < p; val++) {
+			std::uint64_t gval = evaluate(g, val, p);
+			if (evaluate(lca, val, p) == 0 || evaluate(lcb, val, p) == 0) continue;
+			ModPolynomial image;
+			if (!gcd(evaluateLast(ppa, val, p), evaluateLast(ppb, val, p), n - 1, p, image)) return false;
+			Exponents lm = image.rbegin()->first;
+			if (std::all_of(lm.begin(), lm.end(), [](exponent e){ return e == 0; })) {
+				// The primitive parts are coprime.
+				res = ungroup(ModGrouped({{Exponents(n - 1, 0), monic(c, p)}}));
+				return true;
+			}
+			if (points > 0 && leading < lm) continue; // Unlucky evaluation point.
+			if (points == 0 || lm < leading) {
+				// First or all previous evaluation points were unlucky.
+				interpolant.clear();
+				product = ModUnivariate({1});
+				leading = lm;
+				points = 0;
+			}
+			image = scale(image, gval, p);
+			// Newton interpolation step: add (image - interpolant(val)) * product / product(val).
+			std::uint64_t factor = invmod(evaluate(product, val, p), p);
+			bool changed = false;
+			for (const auto& t: image) {
+				interpolant.emplace(t.first, ModUnivariate());
+			}
+			for (auto& t: interpolant) {
+				auto it = image.find(t.first);
+				std::uint64_t target = (it == image.end()) ? 0 : it->second;
+				std::uint64_t delta = submod(target, evaluate(t.second, val, p), p);
+				if (delta == 0) continue;
+				changed = true;
+				addTo(t.second, scale(product, mulmod(delta, factor, p), p), p);
+			}
+			product = multiply(product, ModUnivariate({p - val, 1}), p);
+			points++;
+			if (points > bound || (!changed && points > 1)) {
+				ModGrouped candidate;
+				for (const auto& t: interpolant) {
+					if (!t.second.empty()) candidate.emplace(t.first, t.second);
+				}
+				divideGroups(candidate, contentLast(candidate, p), p);
+				ModPolynomial h = ungroup(candidate);
+				if (divides(ppa, h, p) && divides(ppb, h, p)) {
+					for (auto& t: candidate) t.second = multiply(t.second, c, p);
+					res = monic(ungroup(candidate), p);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+}
+}
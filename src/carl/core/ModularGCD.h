@@ -0,0 +1,204 @@
+/**
+ * @file   ModularGCD.h
+ * @ingroup gcd
+ * @ingroup multirp
+ *
+ * Native modular gcd computation for multivariate polynomials over the integers or rationals.
+ * We follow Brown's dense modular algorithm (@cite GCL92, Algorithms 7.1 and 7.2):
+ * the polynomials are reduced modulo word-sized primes, all but one variable are eliminated by
+ * evaluation, univariate gcds are computed over \f$Z_p\f$ and the result is reconstructed
+ * by Newton interpolation and chinese remaindering.
+ */
+
+#pragma once
+
+#include "carlLogging.h"
+#include "ModularArithmetic.h"
+#include "MultivariatePolynomial.h"
+#include "../numbers/numbers.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Native multivariate gcd for polynomials with integral or rational coefficients.
+ * The result is the primitive integral associate of the gcd with a positive leading coefficient.
+ * @see @cite GCL92, Algorithm 7.1
+ * @ingroup gcd
+ * @ingroup multirp
+ */
+template<typename Coeff, typename Ordering, typename Policies>
+class ModularGCD
+{
+	using Polynomial = MultivariatePolynomial<Coeff,Ordering,Policies>;
+	using Integer = typename IntegralType<Coeff>::type;
+	using Exponents = modular_gcd::Exponents;
+	using IntPolynomial = std::map<Exponents, Integer>;
+
+	const Polynomial& mp1;
+	const Polynomial& mp2;
+	std::vector<Variable> mVariables;
+
+	IntPolynomial toIntegral(const Polynomial& p) const {
+		Integer den = 1;
+		for (const auto& t: p) den = carl::lcm(den, getDenom(t.coeff()));
+		IntPolynomial res;
+		Integer content = 0;
+		for (const auto& t: p) {
+			Exponents e(mVariables.size(), 0);
+			if (t.monomial()) {
+				for (const auto& ve: *t.monomial()) {
+					auto it = std::lower_bound(mVariables.begin(), mVariables.end(), ve.first);
+					e[std::size_t(std::distance(mVariables.begin(), it))] = ve.second;
+				}
+			}
+			Integer c = getNum(Coeff(t.coeff() * den));
+			content = carl::gcd(content, c);
+			res.emplace(e, c);
+		}
+		for (auto& t: res) t.second = carl::div(t.second, content);
+		return res;
+	}
+	Polynomial toPolynomial(const IntPolynomial& p) const {
+		typename Polynomial::TermsType terms;
+		for (const auto& t: p) {
+			std::vector<std::pair<Variable, exponent>> ve;
+			for (std::size_t i = 0; i < t.first.size(); i++) {
+				if (t.first[i] > 0) ve.emplace_back(mVariables[i], t.first[i]);
+			}
+			if (ve.empty()) {
+				terms.emplace_back(Coeff(t.second));
+			} else {
+				terms.emplace_back(Coeff(t.second), createMonomial(std::move(ve)));
+			}
+		}
+		return Polynomial(std::move(terms), false, false);
+	}
+	modular_gcd::ModPolynomial reduce(const IntPolynomial& p, std::uint64_t prime) const {
+		modular_gcd::ModPolynomial res;
+		Integer ip = Integer(carl::sint(prime));
+		for (const auto& t: p) {
+			Integer c = carl::mod(t.second, ip);
+			if (carl::isNegative(c)) c += ip;
+			if (!carl::isZero(c)) res.emplace_hint(res.end(), t.first, toInt<carl::uint>(c));
+		}
+		return res;
+	}
+	/// Checks whether d divides a by means of multivariate division in lexicographic order.
+	bool divides(const IntPolynomial& a, const IntPolynomial& d) const {
+		IntPolynomial r(a);
+		const Exponents& lm = d.rbegin()->first;
+		const Integer& lc = d.rbegin()->second;
+		while (!r.empty()) {
+			auto lt = *r.rbegin();
+			Exponents q(lm.size());
+			for (std::size_t i = 0; i < lm.size(); i++) {
+				if (lt.first[i] < lm[i]) return false;
+				q[i] = lt.first[i] - lm[i];
+			}
+			if (!carl::isZero(carl::mod(lt.second, lc))) return false;
+			Integer c = carl::div(lt.second, lc);
+			for (const auto& t: d) {
+				Exponents e(q);
+				for (std::size_t i = 0; i < e.size(); i++) e[i] += t.first[i];
+				auto it = r.emplace(e, Integer(0)).first;
+				it->second -= c * t.second;
+				if (carl::isZero(it->second)) r.erase(it);
+			}
+		}
+		return true;
+	}
+
+public:
+	ModularGCD(const Polynomial& p1, const Polynomial& p2): mp1(p1), mp2(p2) {
+		std::set<Variable> vars = p1.gatherVariables();
+		p2.gatherVariables(vars);
+		mVariables.assign(vars.begin(), vars.end());
+	}
+
+	/**
+	 * Computes the gcd.
+	 * @param result The gcd, if the computation succeeded.
+	 * @return If the computation succeeded.
+	 */
+	bool calculate(Polynomial& result) const {
+		assert(!mp1.isZero() && !mp2.isZero());
+		IntPolynomial a = toIntegral(mp1);
+		IntPolynomial b = toIntegral(mp2);
+		Integer gamma = carl::gcd(a.rbegin()->second, b.rbegin()->second);
+		std::size_t n = mVariables.size();
+
+		IntPolynomial candidate;
+		Integer modulus = 1;
+		Exponents leading;
+		std::uint64_t prime = modular_gcd::max_prime + 1;
+		// Use at most a few thousand primes, which is beyond anything reasonable.
+		for (std::size_t iteration = 0; iteration < 4096; iteration++) {
+			prime = modular_gcd::previousPrime(prime);
+			Integer ip = Integer(carl::sint(prime));
+			if (carl::isZero(carl::mod(a.rbegin()->second, ip)) || carl::isZero(carl::mod(b.rbegin()->second, ip))) continue;
+			modular_gcd::ModPolynomial image;
+			if (!modular_gcd::gcd(reduce(a, prime), reduce(b, prime), n, prime, image)) continue;
+			Exponents lm = image.rbegin()->first;
+			if (std::all_of(lm.begin(), lm.end(), [](exponent e){ return e == 0; })) {
+				result = Polynomial(Coeff(1));
+				return true;
+			}
+			if (!candidate.empty() && leading < lm) continue; // Unlucky prime.
+			std::uint64_t g = toInt<carl::uint>(Integer(carl::mod(gamma, ip)));
+			image = modular_gcd::scale(image, g, prime);
+			if (candidate.empty() || lm < leading) {
+				candidate.clear();
+				for (const auto& t: image) {
+					candidate.emplace(t.first, Integer(carl::sint(t.second)));
+				}
+				for (auto& t: candidate) {
+					if (t.second > ip / 2) t.second -= ip;
+				}
+				modulus = ip;
+				leading = lm;
+				continue;
+			}
+			// Chinese remaindering of candidate (mod modulus) and image (mod prime).
+			bool changed = false;
+			Integer newModulus = modulus * ip;
+			Integer halfModulus = carl::quotient(newModulus, Integer(2));
+			std::uint64_t inv = modular_gcd::invmod(toInt<carl::uint>(Integer(carl::mod(modulus, ip))), prime);
+			for (const auto& t: image) candidate.emplace(t.first, Integer(0));
+			for (auto it = candidate.begin(); it != candidate.end(); ) {
+				auto imgIt = image.find(it->first);
+				std::uint64_t target = (imgIt == image.end()) ? 0 : imgIt->second;
+				Integer cur = carl::mod(it->second, ip);
+				if (carl::isNegative(cur)) cur += ip;
+				std::uint64_t delta = modular_gcd::submod(target, toInt<carl::uint>(cur), prime);
+				if (delta != 0) {
+					changed = true;
+					it->second += modulus * Integer(carl::sint(modular_gcd::mulmod(delta, inv, prime)));
+					if (it->second > halfModulus) it->second -= newModulus;
+				}
+				if (carl::isZero(it->second)) it = candidate.erase(it);
+				else ++it;
+			}
+			modulus = newModulus;
+			if (changed) continue;
+			Integer content = 0;
+			for (const auto& t: candidate) content = carl::gcd(content, t.second);
+			IntPolynomial primitive;
+			for (const auto& t: candidate) primitive.emplace(t.first, carl::div(t.second, content));
+			if (divides(a, primitive) && divides(b, primitive)) {
+				result = toPolynomial(primitive);
+				if (carl::isNegative(result.lcoeff())) result = -result;
+				CARL_LOG_DEBUG("carl.gcd", "Modular gcd of " << mp1 << " and " << mp2 << " is " << result);
+				return true;
+			}
+		}
+		CARL_LOG_WARN("carl.gcd", "Modular gcd of " << mp1 << " and " << mp2 << " did not converge.");
+		return false;
+	}
+};
+
+}
@@ -0,0 +1,519 @@
+/**
+ * @file   ModularPolynomial.h
+ * @ingroup unirp
+ * @ingroup multirp
+ *
+ * Polynomials over \f$Z_p\f$ for primes \f$p < 2^{63}\f$.
+ * In contrast to polynomials with GFNumber coefficients, the coefficients are stored as plain 64 bit integers
+ * in contiguous arrays and all polynomials of a computation share a single ModularField.
+ */
+
+#pragma once
+
+#include "DivisionResult.h"
+#include "MultivariatePolynomial.h"
+#include "UnivariatePolynomial.h"
+#include "polynomialfunctions/HalfGCD.h"
+#include "../numbers/numbers.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <set>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Arithmetic modulo a prime \f$p < 2^{63}\f$ on integers in \f$[0, p)\f$.
+ * Products are reduced by Barrett reduction if \f$p < 2^{32}\f$ and by 128 bit division otherwise.
+ * Provides the interface of the field arithmetic used by the half-gcd algorithms.
+ */
+class ModularField
+{
+public:
+	using Element = std::uint64_t;
+private:
+	std::uint64_t mP;
+	/// \f$\lfloor (2^{64}-1) / p \rfloor\f$, used for Barrett reduction.
+	std::uint64_t mBarrett;
+	bool mSmall;
+
+	std::uint64_t reduce(std::uint64_t x) const {
+#ifdef __SIZEOF_INT128__
+		std::uint64_t q = std::uint64_t((static_cast<unsigned __int128>(x) * mBarrett) >> 64);
+		std::uint64_t r = x - q * mP;
+		r -= (r >= mP) ? mP : 0;
+		r -= (r >= mP) ? mP : 0;
+		return r;
+#else
+		return x % mP;
+#endif
+	}
+public:
+	explicit ModularField(std::uint64_t p): mP(p), mBarrett(~std::uint64_t(0) / p), mSmall(p < (std::uint64_t(1) << 32)) {
+		assert(p >= 2 && p < (std::uint64_t(1) << 63));
+#ifndef __SIZEOF_INT128__
+		assert(mSmall);
+#endif
+	}
+
+	std::uint64_t p() const {
+		return mP;
+	}
+	Element zero() const {
+		return 0;
+	}
+	Element one() const {
+		return 1;
+	}
+	bool isZero(Element a) const {
+		return a == 0;
+	}
+	Element add(Element a, Element b) const {
+		Element r = a + b;
+		return r - ((r >= mP) ? mP : 0);
+	}
+	Element sub(Element a, Element b) const {
+		return a - b + ((a < b) ? mP : 0);
+	}
+	Element neg(Element a) const {
+		return (a == 0) ? 0 : mP - a;
+	}
+	Element mul(Element a, Element b) const {
+		if (mSmall) return reduce(a * b);
+#ifdef __SIZEOF_INT128__
+		return std::uint64_t((static_cast<unsigned __int128>(a) * b) % mP);
+#else
+		return (a * b) % mP;
+#endif
+	}
+	Element pow(Element a, std::uint64_t e) const {
+		Element res = 1;
+		while (e > 0) {
+			if (e & 1) res = mul(res, a);
+			a = mul(a, a);
+			e >>= 1;
+		}
+		return res;
+	}
+	/// Inverse via Fermat's little theorem.
+	Element inv(Element a) const {
+		assert(a != 0);
+		return pow(a, mP - 2);
+	}
+
+	/// Maps an integer to \f$[0, p)\f$.
+	template<typename Integer>
+	Element fromInteger(const Integer& n) const {
+		Integer ip = Integer(carl::sint(mP));
+		Integer r = carl::mod(n, ip);
+		if (carl::isNegative(r)) r += ip;
+		return toInt<carl::uint>(r);
+	}
+	/// Maps an element to an integer, either in \f$[0, p)\f$ or in the symmetric range \f$(-p/2, p/2]\f$.
+	template<typename Integer>
+	Integer toInteger(Element a, bool symmetric = true) const {
+		if (symmetric && a > mP / 2) return -Integer(carl::sint(mP - a));
+		return Integer(carl::sint(a));
+	}
+
+	bool operator==(const ModularField& rhs) const {
+		return mP == rhs.mP;
+	}
+};
+
+/**
+ * Dense univariate polynomial over \f$Z_p\f$.
+ * @ingroup unirp
+ */
+class ModularUnivariatePolynomial
+{
+	Variable mMainVar;
+	ModularField mField;
+	/// Coefficients in \f$[0, p)\f$ without leading zeros, index i holds the coefficient of \f$x^i\f$.
+	std::vector<std::uint64_t> mCoefficients;
+
+	void stripLeadingZeroes() {
+		half_gcd::strip(mField, mCoefficients);
+	}
+public:
+	ModularUnivariatePolynomial(Variable::Arg mainVar, const ModularField& field): mMainVar(mainVar), mField(field) {}
+	/**
+	 * Constructs a polynomial from its coefficients, starting with the constant coefficient.
+	 * The coefficients are reduced modulo p.
+	 */
+	ModularUnivariatePolynomial(Variable::Arg mainVar, const ModularField& field, std::vector<std::uint64_t> coefficients):
+		mMainVar(mainVar), mField(field), mCoefficients(std::move(coefficients))
+	{
+		for (auto& c: mCoefficients) c %= mField.p();
+		stripLeadingZeroes();
+	}
+	/// Reduces an integral polynomial modulo p.
+	template<typename Integer>
+	ModularUnivariatePolynomial(const UnivariatePolynomial<Integer>& p, const ModularField& field): mMainVar(p.mainVar()), mField(field) {
+		mCoefficients.reserve(p.coefficients().size());
+		for (const auto& c: p.coefficients()) mCoefficients.push_back(mField.fromInteger(c));
+		stripLeadingZeroes();
+	}
+
+	/**
+	 * Converts to an integral polynomial.
+	 * @param symmetric Use the symmetric range \f$(-p/2, p/2]\f$ for the coefficients.
+	 */
+	template<typename Integer>
+	UnivariatePolynomial<Integer> toIntegerDomain(bool symmetric = true) const {
+		std::vector<Integer> coeffs;
+		coeffs.reserve(mCoefficients.size());
+		for (const auto& c: mCoefficients) coeffs.push_back(mField.toInteger<Integer>(c, symmetric));
+		return UnivariatePolynomial<Integer>(mMainVar, coeffs);
+	}
+
+	Variable::Arg mainVar() const {
+		return mMainVar;
+	}
+	const ModularField& field() const {
+		return mField;
+	}
+	const std::vector<std::uint64_t>& coefficients() const {
+		return mCoefficients;
+	}
+	bool isZero() const {
+		return mCoefficients.empty();
+	}
+	/// Degree, where the zero polynomial has degree zero.
+	std::size_t degree() const {
+		return mCoefficients.empty() ? 0 : mCoefficients.size() - 1;
+	}
+	std::uint64_t lcoeff() const {
+		return mCoefficients.empty() ? 0 : mCoefficients.back();
+	}
+
+	std::uint64_t evaluate(std::uint64_t value) const {
+		std::uint64_t res = 0;
+		for (auto it = mCoefficients.rbegin(); it != mCoefficients.rend(); ++it) {
+			res = mField.add(mField.mul(res, value), *it);
+		}
+		return res;
+	}
+	ModularUnivariatePolynomial derivative() const {
+		ModularUnivariatePolynomial res(mMainVar, mField);
+		if (mCoefficients.size() < 2) return res;
+		res.mCoefficients.resize(mCoefficients.size() - 1);
+		for (std::size_t i = 1; i < mCoefficients.size(); i++) {
+			res.mCoefficients[i-1] = mField.mul(mCoefficients[i], i % mField.p());
+		}
+		res.stripLeadingZeroes();
+		return res;
+	}
+	/// Returns the associated monic polynomial.
+	ModularUnivariatePolynomial normalized() const {
+		if (isZero()) return *this;
+		return *this * mField.inv(lcoeff());
+	}
+
+	ModularUnivariatePolynomial& operator+=(const ModularUnivariatePolynomial& rhs) {
+		assert(mMainVar == rhs.mMainVar && mField == rhs.mField);
+		if (mCoefficients.size() < rhs.mCoefficients.size()) mCoefficients.resize(rhs.mCoefficients.size(), 0);
+		for (std::size_t i = 0; i < rhs.mCoefficients.size(); i++) {
+			mCoefficients[i] = mField.add(mCoefficients[i], rhs.mCoefficients[i]);
+		}
+		stripLeadingZeroes();
+		return *this;
+	}
+	ModularUnivariatePolynomial& operator-=(const ModularUnivariatePolynomial& rhs) {
+		assert(mMainVar == rhs.mMainVar && mField == rhs.mField);
+		if (mCoefficients.size() < rhs.mCoefficients.size()) mCoefficients.resize(rhs.mCoefficients.size(), 0);
+		for (std::size_t i = 0; i < rhs.mCoefficients.size(); i++) {
+			mCoefficients[i] = mField.sub(mCoefficients[i], rhs.mCoefficients[i]);
+		}
+		stripLeadingZeroes();
+		return *this;
+	}
+	ModularUnivariatePolynomial& operator*=(std::uint64_t rhs) {
+		rhs %= mField.p();
+		for (auto& c: mCoefficients) c = mField.mul(c, rhs);
+		stripLeadingZeroes();
+		return *this;
+	}
+	ModularUnivariatePolynomial& operator*=(const ModularUnivariatePolynomial& rhs) {
+		assert(mMainVar == rhs.mMainVar && mField == rhs.mField);
+		mCoefficients = half_gcd::multiply(mField, mCoefficients, rhs.mCoefficients);
+		return *this;
+	}
+	friend ModularUnivariatePolynomial operator+(ModularUnivariatePolynomial lhs, const ModularUnivariatePolynomial& rhs) {
+		return lhs += rhs;
+	}
+	friend ModularUnivariatePolynomial operator-(ModularUnivariatePolynomial lhs, const ModularUnivariatePolynomial& rhs) {
+		return lhs -= rhs;
+	}
+	friend ModularUnivariatePolynomial operator*(ModularUnivariatePolynomial lhs, const ModularUnivariatePolynomial& rhs) {
+		return lhs *= rhs;
+	}
+	friend ModularUnivariatePolynomial operator*(ModularUnivariatePolynomial lhs, std::uint64_t rhs) {
+		return lhs *= rhs;
+	}
+
+	DivisionResult<ModularUnivariatePolynomial> divideBy(const ModularUnivariatePolynomial& divisor) const {
+		assert(!divisor.isZero());
+		assert(mMainVar == divisor.mMainVar && mField == divisor.mField);
+		DivisionResult<ModularUnivariatePolynomial> res(ModularUnivariatePolynomial(mMainVar, mField), ModularUnivariatePolynomial(mMainVar, mField));
+		half_gcd::divide(mField, mCoefficients, divisor.mCoefficients, res.quotient.mCoefficients, res.remainder.mCoefficients);
+		return res;
+	}
+	ModularUnivariatePolynomial remainder(const ModularUnivariatePolynomial& divisor) const {
+		return divideBy(divisor).remainder;
+	}
+	/// Computes the monic gcd by the half-gcd method.
+	static ModularUnivariatePolynomial gcd(const ModularUnivariatePolynomial& a, const ModularUnivariatePolynomial& b) {
+		assert(a.mMainVar == b.mMainVar && a.mField == b.mField);
+		ModularUnivariatePolynomial res(a.mMainVar, a.mField);
+		res.mCoefficients = half_gcd::gcd(a.mField, a.mCoefficients, b.mCoefficients);
+		return res;
+	}
+
+	bool operator==(const ModularUnivariatePolynomial& rhs) const {
+		return mMainVar == rhs.mMainVar && mField == rhs.mField && mCoefficients == rhs.mCoefficients;
+	}
+	bool operator!=(const ModularUnivariatePolynomial& rhs) const {
+		return !(*this == rhs);
+	}
+	friend std::ostream& operator<<(std::ostream& os, const ModularUnivariatePolynomial& p) {
+		os << "(";
+		if (p.isZero()) os << "0";
+		for (std::size_t i = p.mCoefficients.size(); i-- > 0; ) {
+			if (p.mCoefficients[i] == 0) continue;
+			if (i + 1 != p.mCoefficients.size()) os << " + ";
+			os << p.mCoefficients[i];
+			if (i > 0) os << "*" << p.mMainVar << "^" << i;
+		}
+		return os << ") mod " << p.mField.p();
+	}
+};
+
+/**
+ * Sparse multivariate polynomial over \f$Z_p\f$.
+ * The variables are fixed on construction, the exponent vectors of all terms are stored in a single array
+ * and the terms are ordered lexicographically with respect to the exponent vectors.
+ * @ingroup multirp
+ */
+class ModularMultivariatePolynomial
+{
+	std::vector<Variable> mVariables;
+	ModularField mField;
+	/// Exponent vectors of the terms, each of size mVariables.size().
+	std::vector<exponent> mExponents;
+	/// Coefficients of the terms, all nonzero.
+	std::vector<std::uint64_t> mCoefficients;
+
+	std::size_t width() const {
+		return mVariables.size();
+	}
+	const exponent* exponents(std::size_t term) const {
+		return mExponents.data() + term * width();
+	}
+	bool less(const exponent* a, const exponent* b) const {
+		return std::lexicographical_compare(a, a + width(), b, b + width());
+	}
+	bool equal(const exponent* a, const exponent* b) const {
+		return std::equal(a, a + width(), b);
+	}
+	void pushTerm(const exponent* e, std::uint64_t c) {
+		mExponents.insert(mExponents.end(), e, e + width());
+		mCoefficients.push_back(c);
+	}
+	/// Sorts the terms and combines terms with equal exponents.
+	void normalize() {
+		std::vector<std::size_t> order(mCoefficients.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b){ return less(exponents(a), exponents(b)); });
+		std::vector<exponent> exps;
+		std::vector<std::uint64_t> coeffs;
+		exps.reserve(mExponents.size());
+		coeffs.reserve(mCoefficients.size());
+		for (std::size_t t: order) {
+			if (!coeffs.empty() && equal(exps.data() + exps.size() - width(), exponents(t))) {
+				coeffs.back() = mField.add(coeffs.back(), mCoefficients[t]);
+				continue;
+			}
+			if (!coeffs.empty() && coeffs.back() == 0) {
+				coeffs.pop_back();
+				exps.resize(exps.size() - width());
+			}
+			exps.insert(exps.end(), exponents(t), exponents(t) + width());
+			coeffs.push_back(mCoefficients[t]);
+		}
+		if (!coeffs.empty() && coeffs.back() == 0) {
+			coeffs.pop_back();
+			exps.resize(exps.size() - width());
+		}
+		mExponents.swap(exps);
+		mCoefficients.swap(coeffs);
+	}
+	template<typename Op>
+	ModularMultivariatePolynomial merge(const ModularMultivariatePolynomial& rhs, Op op) const {
+		assert(mVariables == rhs.mVariables && mField == rhs.mField);
+		ModularMultivariatePolynomial res(mVariables, mField);
+		std::size_t i = 0;
+		std::size_t j = 0;
+		while (i < nterms() || j < rhs.nterms()) {
+			if (j == rhs.nterms() || (i < nterms() && less(exponents(i), rhs.exponents(j)))) {
+				res.pushTerm(exponents(i), mCoefficients[i]);
+				i++;
+			} else if (i == nterms() || less(rhs.exponents(j), exponents(i))) {
+				res.pushTerm(rhs.exponents(j), op(std::uint64_t(0), rhs.mCoefficients[j]));
+				j++;
+			} else {
+				std::uint64_t c = op(mCoefficients[i], rhs.mCoefficients[j]);
+				if (c != 0) res.pushTerm(exponents(i), c);
+				i++;
+				j++;
+			}
+		}
+		return res;
+	}
+public:
+	ModularMultivariatePolynomial(std::vector<Variable> variables, const ModularField& field): mVariables(std::move(variables)), mField(field) {
+		assert(std::is_sorted(mVariables.begin(), mVariables.end()));
+	}
+	/**
+	 * Reduces an integral polynomial modulo p.
+	 * @param p Polynomial.
+	 * @param field Field.
+	 * @param variables Sorted variables, must contain all variables of p.
+	 */
+	template<typename Integer, typename Ordering, typename Policies>
+	ModularMultivariatePolynomial(const MultivariatePolynomial<Integer,Ordering,Policies>& p, const ModularField& field, std::vector<Variable> variables):
+		ModularMultivariatePolynomial(std::move(variables), field)
+	{
+		std::vector<exponent> e(width());
+		for (const auto& t: p) {
+			std::uint64_t c = mField.fromInteger(t.coeff());
+			if (c == 0) continue;
+			std::fill(e.begin(), e.end(), 0);
+			if (t.monomial()) {
+				for (const auto& ve: *t.monomial()) {
+					auto it = std::lower_bound(mVariables.begin(), mVariables.end(), ve.first);
+					assert(it != mVariables.end() && *it == ve.first);
+					e[std::size_t(std::distance(mVariables.begin(), it))] = ve.second;
+				}
+			}
+			pushTerm(e.data(), c);
+		}
+		normalize();
+	}
+	/// Reduces an integral polynomial modulo p, using the variables of p.
+	template<typename Integer, typename Ordering, typename Policies>
+	ModularMultivariatePolynomial(const MultivariatePolynomial<Integer,Ordering,Policies>& p, const ModularField& field):
+		ModularMultivariatePolynomial(p, field, [&p](){ std::set<Variable> vars = p.gatherVariables(); return std::vector<Variable>(vars.begin(), vars.end()); }())
+	{}
+
+	/**
+	 * Converts to an integral polynomial.
+	 * @param symmetric Use the symmetric range \f$(-p/2, p/2]\f$ for the coefficients.
+	 */
+	template<typename Integer>
+	MultivariatePolynomial<Integer> toIntegerDomain(bool symmetric = true) const {
+		typename MultivariatePolynomial<Integer>::TermsType terms;
+		for (std::size_t t = 0; t < nterms(); t++) {
+			std::vector<std::pair<Variable, exponent>> ve;
+			for (std::size_t i = 0; i < width(); i++) {
+				if (exponents(t)[i] > 0) ve.emplace_back(mVariables[i], exponents(t)[i]);
+			}
+			Integer c = mField.toInteger<Integer>(mCoefficients[t], symmetric);
+			if (ve.empty()) terms.emplace_back(c);
+			else terms.emplace_back(c, createMonomial(std::move(ve)));
+		}
+		return MultivariatePolynomial<Integer>(std::move(terms));
+	}
+
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	const ModularField& field() const {
+		return mField;
+	}
+	std::size_t nterms() const {
+		return mCoefficients.size();
+	}
+	bool isZero() const {
+		return mCoefficients.empty();
+	}
+	/// Total degree.
+	std::size_t totalDegree() const {
+		std::size_t res = 0;
+		for (std::size_t t = 0; t < nterms(); t++) {
+			res = std::max(res, std::size_t(std::accumulate(exponents(t), exponents(t) + width(), exponent(0))));
+		}
+		return res;
+	}
+
+	/// Evaluates the polynomial, where values[i] is assigned to the i'th variable.
+	std::uint64_t evaluate(const std::vector<std::uint64_t>& values) const {
+		assert(values.size() == width());
+		std::uint64_t res = 0;
+		for (std::size_t t = 0; t < nterms(); t++) {
+			std::uint64_t c = mCoefficients[t];
+			for (std::size_t i = 0; i < width(); i++) {
+				if (exponents(t)[i] > 0) c = mField.mul(c, mField.pow(values[i] % mField.p(), exponents(t)[i]));
+			}
+			res = mField.add(res, c);
+		}
+		return res;
+	}
+
+	ModularMultivariatePolynomial operator+(const ModularMultivariatePolynomial& rhs) const {
+		return merge(rhs, [this](std::uint64_t a, std::uint64_t b){ return mField.add(a, b); });
+	}
+	ModularMultivariatePolynomial operator-(const ModularMultivariatePolynomial& rhs) const {
+		return merge(rhs, [this](std::uint64_t a, std::uint64_t b){ return mField.sub(a, b); });
+	}
+	ModularMultivariatePolynomial operator*(std::uint64_t rhs) const {
+		ModularMultivariatePolynomial res(mVariables, mField);
+		rhs %= mField.p();
+		if (rhs == 0) return res;
+		res.mExponents = mExponents;
+		res.mCoefficients.reserve(nterms());
+		for (const auto& c: mCoefficients) res.mCoefficients.push_back(mField.mul(c, rhs));
+		return res;
+	}
+	ModularMultivariatePolynomial operator*(const ModularMultivariatePolynomial& rhs) const {
+		assert(mVariables == rhs.mVariables && mField == rhs.mField);
+		ModularMultivariatePolynomial res(mVariables, mField);
+		res.mExponents.reserve(nterms() * rhs.nterms() * width());
+		res.mCoefficients.reserve(nterms() * rhs.nterms());
+		std::vector<exponent> e(width());
+		for (std::size_t i = 0; i < nterms(); i++) {
+			for (std::size_t j = 0; j < rhs.nterms(); j++) {
+				for (std::size_t k = 0; k < width(); k++) e[k] = exponents(i)[k] + rhs.exponents(j)[k];
+				res.pushTerm(e.data(), mField.mul(mCoefficients[i], rhs.mCoefficients[j]));
+			}
+		}
+		res.normalize();
+		return res;
+	}
+
+	bool operator==(const ModularMultivariatePolynomial& rhs) const {
+		return mVariables == rhs.mVariables && mField == rhs.mField && mExponents == rhs.mExponents && mCoefficients == rhs.mCoefficients;
+	}
+	bool operator!=(const ModularMultivariatePolynomial& rhs) const {
+		return !(*this == rhs);
+	}
+	friend std::ostream& operator<<(std::ostream& os, const ModularMultivariatePolynomial& p) {
+		os << "(";
+		if (p.isZero()) os << "0";
+		for (std::size_t t = 0; t < p.nterms(); t++) {
+			if (t > 0) os << " + ";
+			os << p.mCoefficients[t];
+			for (std::size_t i = 0; i < p.width(); i++) {
+				if (p.exponents(t)[i] > 0) os << "*" << p.mVariables[i] << "^" << p.exponents(t)[i];
+			}
+		}
+		return os << ") mod " << p.mField.p();
+	}
+};
+
+}
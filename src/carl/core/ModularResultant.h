@@ -0,0 +1,304 @@
+/**
+ * @file   ModularResultant.h
+ * @ingroup unirp
+ * @ingroup multirp
+ *
+ * Native modular resultant computation for univariate polynomials whose coefficients are multivariate polynomials over the integers or rationals.
+ * We follow Collins' dense modular algorithm (@cite GCL92, Algorithm 9.3):
+ * the polynomials are reduced modulo word-sized primes, all coefficient variables are eliminated by
+ * evaluation, univariate resultants are computed over \f$Z_p\f$ and the result is reconstructed
+ * by Newton interpolation and chinese remaindering.
+ */
+
+#pragma once
+
+#include "carlLogging.h"
+#include "ModularArithmetic.h"
+#include "MultivariatePolynomial.h"
+#include "UnivariatePolynomial.h"
+#include "../numbers/numbers.h"
+
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace carl
+{
+namespace modular_resultant
+{
+	using modular_gcd::Exponents;
+	using modular_gcd::ModPolynomial;
+	using modular_gcd::ModUnivariate;
+	using modular_gcd::ModGrouped;
+
+	/// Univariate polynomial in the main variable whose coefficients are sparse polynomials over \f$Z_p\f$.
+	using ModRecursive = std::vector<ModPolynomial>;
+
+	/**
+	 * Computes the resultant of two univariate polynomials over \f$Z_p\f$ of positive degree by the euclidean algorithm.
+	 * @see @cite GCL92, Algorithm 9.1
+	 */
+	inline std::uint64_t resultant(ModUnivariate a, ModUnivariate b, std::uint64_t p) {
+		assert(a.size() > 1 && b.size() > 1);
+		std::uint64_t res = 1;
+		while (b.size() > 1) {
+			std::size_t da = a.size() - 1;
+			std::size_t db = b.size() - 1;
+			std::uint64_t lcb = b.back();
+			modular_gcd::divide(a, b, p);
+			if (a.empty()) return 0;
+			res = modular_gcd::mulmod(res, modular_gcd::powmod(lcb, da - (a.size() - 1), p), p);
+			if (da % 2 == 1 && db % 2 == 1) res = p - res;
+			std::swap(a, b);
+		}
+		return modular_gcd::mulmod(res, modular_gcd::powmod(b.front(), a.size() - 1, p), p);
+	}
+
+	/**
+	 * Computes the resultant of two polynomials over \f$Z_p\f$ whose coefficients have n variables.
+	 * The coefficient variables are eliminated one after another by evaluation and the result is recovered by dense interpolation.
+	 * Evaluation points where one of the leading coefficients vanishes are skipped, hence the degrees in the main variable are preserved.
+	 * @param a First polynomial, the leading coefficient must be nonzero.
+	 * @param b Second polynomial, the leading coefficient must be nonzero.
+	 * @param bounds Degree bounds of the resultant for every coefficient variable.
+	 * @param n Number of coefficient variables.
+	 * @param p Prime.
+	 * @param res Resulting resultant.
+	 * @return false if we ran out of evaluation points.
+	 */
+	inline bool resultant(const ModRecursive& a, const ModRecursive& b, const std::vector<std::size_t>& bounds, std::size_t n, std::uint64_t p, ModPolynomial& res) {
+		assert(!a.back().empty() && !b.back().empty());
+		res.clear();
+		if (n == 0) {
+			auto toUnivariate = [](const ModRecursive& r){
+				ModUnivariate u;
+				for (const auto& c: r) u.push_back(c.empty() ? 0 : c.begin()->second);
+				return u;
+			};
+			modular_gcd::addTerm(res, Exponents(), resultant(toUnivariate(a), toUnivariate(b), p), p);
+			return true;
+		}
+		ModGrouped interpolant;
+		ModUnivariate product({1});
+		std::size_t points = 0;
+		for (std::uint64_t val = 0; val < p && points <= bounds[n - 1]; val++) {
+			ModRecursive ea;
+			ModRecursive eb;
+			for (const auto& c: a) ea.push_back(modular_gcd::evaluateLast(c, val, p));
+			for (const auto& c: b) eb.push_back(modular_gcd::evaluateLast(c, val, p));
+			if (ea.back().empty() || eb.back().empty()) continue;
+			ModPolynomial image;
+			if (!resultant(ea, eb, bounds, n - 1, p, image)) return false;
+			// Newton interpolation step: add (image - interpolant(val)) * product / product(val).
+			std::uint64_t factor = modular_gcd::invmod(modular_gcd::evaluate(product, val, p), p);
+			for (const auto& t: image) {
+				interpolant.emplace(t.first, ModUnivariate());
+			}
+			for (auto& t: interpolant) {
+				auto it = image.find(t.first);
+				std::uint64_t target = (it == image.end()) ? 0 : it->second;
+				std::uint64_t delta = modular_gcd::submod(target, modular_gcd::evaluate(t.second, val, p), p);
+				if (delta == 0) continue;
+				modular_gcd::addTo(t.second, modular_gcd::scale(product, modular_gcd::mulmod(delta, factor, p), p), p);
+			}
+			product = modular_gcd::multiply(product, ModUnivariate({p - val, 1}), p);
+			points++;
+		}
+		if (points <= bounds[n - 1]) return false;
+		res = modular_gcd::ungroup(interpolant);
+		return true;
+	}
+}
+
+/**
+ * Native resultant computation for univariate polynomials whose coefficients are multivariate polynomials with integral or rational coefficients.
+ * The result equals the resultant as defined by the Sylvester matrix.
+ * The chinese remaindering stops once the product of the primes exceeds twice the bound on the coefficients from @cite GCL92, Theorem 9.3,
+ * or early if the reconstructed resultant did not change for a few consecutive primes.
+ * @ingroup unirp
+ */
+template<typename Coeff, typename Ordering, typename Policies>
+class ModularResultant
+{
+	using Polynomial = MultivariatePolynomial<Coeff,Ordering,Policies>;
+	using UPolynomial = UnivariatePolynomial<Polynomial>;
+	using Integer = typename IntegralType<Coeff>::type;
+	using Exponents = modular_gcd::Exponents;
+	using IntPolynomial = std::map<Exponents, Integer>;
+	using IntRecursive = std::vector<IntPolynomial>;
+
+	/// Number of consecutive primes that must leave the reconstruction unchanged for an early termination.
+	static constexpr std::size_t stable_primes = 2;
+
+	const UPolynomial& mp1;
+	const UPolynomial& mp2;
+	std::vector<Variable> mVariables;
+
+	/**
+	 * Converts p to a polynomial with coprime integral coefficients.
+	 * @param p Polynomial.
+	 * @param scale Factor such that p equals scale times the result.
+	 */
+	IntRecursive toIntegral(const UPolynomial& p, Coeff& scale) const {
+		Integer den = 1;
+		for (const auto& c: p.coefficients()) {
+			for (const auto& t: c) den = carl::lcm(den, getDenom(t.coeff()));
+		}
+		IntRecursive res;
+		Integer content = 0;
+		for (const auto& c: p.coefficients()) {
+			res.emplace_back();
+			for (const auto& t: c) {
+				Exponents e(mVariables.size(), 0);
+				if (t.monomial()) {
+					for (const auto& ve: *t.monomial()) {
+						auto it = std::lower_bound(mVariables.begin(), mVariables.end(), ve.first);
+						e[std::size_t(std::distance(mVariables.begin(), it))] = ve.second;
+					}
+				}
+				Integer n = getNum(Coeff(t.coeff() * den));
+				content = carl::gcd(content, n);
+				res.back().emplace(e, n);
+			}
+		}
+		for (auto& c: res) {
+			for (auto& t: c) t.second = carl::div(t.second, content);
+		}
+		scale = Coeff(content) / Coeff(den);
+		return res;
+	}
+	Polynomial toPolynomial(const IntPolynomial& p) const {
+		typename Polynomial::TermsType terms;
+		for (const auto& t: p) {
+			std::vector<std::pair<Variable, exponent>> ve;
+			for (std::size_t i = 0; i < t.first.size(); i++) {
+				if (t.first[i] > 0) ve.emplace_back(mVariables[i], t.first[i]);
+			}
+			if (ve.empty()) {
+				terms.emplace_back(Coeff(t.second));
+			} else {
+				terms.emplace_back(Coeff(t.second), createMonomial(std::move(ve)));
+			}
+		}
+		return Polynomial(std::move(terms), false, false);
+	}
+	modular_resultant::ModRecursive reduce(const IntRecursive& p, std::uint64_t prime) const {
+		modular_resultant::ModRecursive res;
+		Integer ip = Integer(carl::sint(prime));
+		for (const auto& c: p) {
+			res.emplace_back();
+			for (const auto& t: c) {
+				Integer r = carl::mod(t.second, ip);
+				if (carl::isNegative(r)) r += ip;
+				if (!carl::isZero(r)) res.back().emplace_hint(res.back().end(), t.first, toInt<carl::uint>(r));
+			}
+		}
+		return res;
+	}
+	/// Sum of the absolute values of all coefficients.
+	Integer oneNorm(const IntRecursive& p) const {
+		Integer res = 0;
+		for (const auto& c: p) {
+			for (const auto& t: c) res += carl::abs(t.second);
+		}
+		return res;
+	}
+	/// Maximum degree of every coefficient variable.
+	std::vector<std::size_t> degrees(const IntRecursive& p) const {
+		std::vector<std::size_t> res(mVariables.size(), 0);
+		for (const auto& c: p) {
+			for (const auto& t: c) {
+				for (std::size_t i = 0; i < res.size(); i++) res[i] = std::max(res[i], std::size_t(t.first[i]));
+			}
+		}
+		return res;
+	}
+
+public:
+	ModularResultant(const UPolynomial& p1, const UPolynomial& p2): mp1(p1), mp2(p2) {
+		assert(p1.mainVar() == p2.mainVar());
+		std::set<Variable> vars;
+		for (const auto& c: p1.coefficients()) c.gatherVariables(vars);
+		for (const auto& c: p2.coefficients()) c.gatherVariables(vars);
+		mVariables.assign(vars.begin(), vars.end());
+	}
+
+	/**
+	 * Computes the resultant.
+	 * Both polynomials must have a positive degree.
+	 * @param result The resultant, if the computation succeeded.
+	 * @return If the computation succeeded.
+	 */
+	bool calculate(UPolynomial& result) const {
+		assert(mp1.degree() > 0 && mp2.degree() > 0);
+		Coeff scale1;
+		Coeff scale2;
+		IntRecursive a = toIntegral(mp1, scale1);
+		IntRecursive b = toIntegral(mp2, scale2);
+		std::size_t da = a.size() - 1;
+		std::size_t db = b.size() - 1;
+		std::size_t n = mVariables.size();
+
+		std::vector<std::size_t> bounds(n, 0);
+		std::vector<std::size_t> degA = degrees(a);
+		std::vector<std::size_t> degB = degrees(b);
+		for (std::size_t i = 0; i < n; i++) bounds[i] = db * degA[i] + da * degB[i];
+		Integer coefficientBound = Integer(2) * carl::pow(oneNorm(a), db) * carl::pow(oneNorm(b), da);
+
+		IntPolynomial candidate;
+		Integer modulus = 1;
+		std::size_t stable = 0;
+		std::uint64_t prime = modular_gcd::max_prime + 1;
+		// Use at most a few thousand primes, which is beyond anything reasonable.
+		for (std::size_t iteration = 0; iteration < 4096; iteration++) {
+			prime = modular_gcd::previousPrime(prime);
+			modular_resultant::ModRecursive ma = reduce(a, prime);
+			modular_resultant::ModRecursive mb = reduce(b, prime);
+			if (ma.back().empty() || mb.back().empty()) continue; // The degree in the main variable drops.
+			modular_gcd::ModPolynomial image;
+			if (!modular_resultant::resultant(ma, mb, bounds, n, prime, image)) continue;
+			// Chinese remaindering of candidate (mod modulus) and image (mod prime).
+			Integer ip = Integer(carl::sint(prime));
+			bool changed = false;
+			Integer newModulus = modulus * ip;
+			Integer halfModulus = carl::quotient(newModulus, Integer(2));
+			std::uint64_t inv = modular_gcd::invmod(toInt<carl::uint>(Integer(carl::mod(modulus, ip))), prime);
+			for (const auto& t: image) candidate.emplace(t.first, Integer(0));
+			for (auto it = candidate.begin(); it != candidate.end(); ) {
+				auto imgIt = image.find(it->first);
+				std::uint64_t target = (imgIt == image.end()) ? 0 : imgIt->second;
+				Integer cur = carl::mod(it->second, ip);
+				if (carl::isNegative(cur)) cur += ip;
+				std::uint64_t delta = modular_gcd::submod(target, toInt<carl::uint>(cur), prime);
+				if (delta != 0) {
+					changed = true;
+					it->second += modulus * Integer(carl::sint(modular_gcd::mulmod(delta, inv, prime)));
+					if (it->second > halfModulus) it->second -= newModulus;
+				}
+				if (carl::isZero(it->second)) it = candidate.erase(it);
+				else ++it;
+			}
+			modulus = newModulus;
+			stable = changed ? 0 : stable + 1;
+			if (modulus <= coefficientBound && stable < stable_primes) continue;
+			Coeff factor = carl::pow(scale1, db) * carl::pow(scale2, da);
+			result = UPolynomial(mp1.mainVar(), toPolynomial(candidate) * factor);
+			CARL_LOG_DEBUG("carl.core.resultant", "Modular resultant of " << mp1 << " and " << mp2 << " is " << result);
+			return true;
+		}
+		CARL_LOG_WARN("carl.core.resultant", "Modular resultant of " << mp1 << " and " << mp2 << " did not converge.");
+		return false;
+	}
+};
+
+namespace helper {
+	template<typename C, typename O, typename P>
+	struct ModularResultant<MultivariatePolynomial<C,O,P>, typename std::enable_if<is_rational<C>::value || is_integer<C>::value>::type> {
+		bool operator()(const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& p, const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& q, UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& result) const {
+			return carl::ModularResultant<C,O,P>(p, q).calculate(result);
+		}
+	};
+}
+
+}
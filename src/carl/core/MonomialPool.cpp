@@ -13,22 +13,18 @@ namespace carl
 	Monomial::Arg MonomialPool::add( MonomialPool::PoolEntry&& pe, exponent totalDegree) {
 		MONOMIAL_POOL_LOCK_GUARD
 		auto iter = mPool.insert(std::move(pe));
-		Monomial::Arg res;
-		if (iter.second) {
-			if (iter.first->monomial.expired()) {
-				if (totalDegree == 0) {
-					res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content));
-					iter.first->monomial = res;
-				} else {
-					res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content, totalDegree));
-					iter.first->monomial = res;
-				}
+		Monomial::Arg res = iter.first->monomial.lock();
+		if (!res) {
+			// Either a new entry, or an entry that outlived its monomial, for example if the variable pool was cleared in between.
+			if (totalDegree == 0) {
+				res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content));
 			} else {
-				res = iter.first->monomial.lock();
+				res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content, totalDegree));
 			}
+			iter.first->monomial = res;
+			res->mId = mIDs.get();
+		} else if (iter.second) {
 			res->mId = mIDs.get();
-		} else {
-			res = iter.first->monomial.lock();
 		}
 		return res;
 	}
@@ -41,10 +37,15 @@ namespace carl
 		if (iter.second) {
 			_monomial->mId = mIDs.get();
 			return _monomial;
-		} else {
-			assert(_monomial == iter.first->monomial.lock());
-			return iter.first->monomial.lock();
 		}
+		Monomial::Arg res = iter.first->monomial.lock();
+		if (!res) {
+			iter.first->monomial = _monomial;
+			_monomial->mId = mIDs.get();
+			return _monomial;
+		}
+		assert(_monomial == res);
+		return res;
 	}
 #else
 	Monomial::Arg MonomialPool::add( MonomialPool::PoolEntry&& pe, exponent totalDegree) {
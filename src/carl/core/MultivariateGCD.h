@@ -19,6 +19,8 @@ template<typename C, typename O, typename P>
 class MultivariatePolynomial;
 template<typename C>
 class UnivariatePolynomial;
+template<typename C, typename O, typename P>
+class ModularGCD;
 
 
 	
@@ -115,6 +117,10 @@ class MultivariateGCD : GCDCalculation
 		
 	}
 	
+	/**
+	 * Computes the gcd natively with ModularGCD and falls back to customCalculation() if this fails.
+	 */
+	Polynomial modularCalculation(const Polynomial& a, const Polynomial& b);
 	Polynomial customCalculation(const Polynomial& a, const Polynomial& b);
     
     #ifdef USE_GINAC
@@ -143,5 +149,6 @@ class MultivariateGCD : GCDCalculation
 
 }
 #include "PrimitiveEuclideanAlgorithm.h"
+#include "ModularGCD.h"
 #include "MultivariateGCD.tpp"
 #include "PrimitiveEuclideanAlgorithm.tpp"	
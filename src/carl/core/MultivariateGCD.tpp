@@ -61,8 +61,8 @@ auto s = carl::createFunctionSelector<TypeSelector, types>(
 	[](const auto& n1, const auto& n2){ CoCoAAdaptor<Polynomial> c({n1, n2}); return c.gcd(n1,n2); },
 	[](const auto& n1, const auto& n2){ CoCoAAdaptor<Polynomial> c({n1, n2}); return c.gcd(n1,n2); }
 #else
-	[this](const auto& n1, const auto& n2){ return this->customCalculation(n1,n2); },
-	[this](const auto& n1, const auto& n2){ return this->customCalculation(n1,n2); }
+	[this](const auto& n1, const auto& n2){ return this->modularCalculation(n1,n2); },
+	[this](const auto& n1, const auto& n2){ return this->modularCalculation(n1,n2); }
 #endif
 #if defined USE_GINAC
 	,
@@ -73,6 +73,15 @@ auto s = carl::createFunctionSelector<TypeSelector, types>(
 	return s(mp1, mp2);
 }
 
+template<typename GCDCalculation, typename C, typename O, typename P>
+MultivariatePolynomial<C,O,P> MultivariateGCD<GCDCalculation, C, O, P>::modularCalculation(const Polynomial& a, const Polynomial& b) {
+	Polynomial result;
+	if (ModularGCD<C,O,P>(a, b).calculate(result)) {
+		return result;
+	}
+	return customCalculation(a, b);
+}
+
 template<typename GCDCalculation, typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> MultivariateGCD<GCDCalculation, C, O, P>::customCalculation(const Polynomial& a, const Polynomial& b) {
 	Variable x = getMainVar(a, b);
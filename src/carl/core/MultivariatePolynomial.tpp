@@ -683,6 +683,8 @@ bool MultivariatePolynomial<Coeff,Ordering,Policies>::divideBy(const Multivariat
 			//p -= factor * divisor;
 			mTermAdditionManager.template addTerm<true>(id, factor);
 		} else {
+			mTermAdditionManager.dropTerms(id);
+			mTermAdditionManager.dropTerms(thisid);
 			return false;
 		}
 	}
@@ -0,0 +1,197 @@
+/**
+ * @file   SturmSequenceCache.h
+ * @ingroup unirp
+ *
+ * Bounded cache for Sturm sequences and principal subresultant coefficients of univariate polynomials.
+ * Root counting on several intervals, refinement of real algebraic numbers and CAD lifting ask repeatedly
+ * for the same sequences. With the cache, such queries only evaluate the signs of the cached sequence.
+ */
+
+#pragma once
+
+#include "UnivariatePolynomial.h"
+#include "polynomialfunctions/Resultant.h"
+#include "../util/hash.h"
+#include "../util/Singleton.h"
+
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Statistics of a SturmSequenceCache.
+ */
+struct SturmSequenceCacheStatistics {
+	/// Number of queries answered from the cache.
+	std::size_t hits = 0;
+	/// Number of queries that were computed.
+	std::size_t misses = 0;
+	/// Number of entries removed due to the capacity.
+	std::size_t evictions = 0;
+};
+inline std::ostream& operator<<(std::ostream& os, const SturmSequenceCacheStatistics& s) {
+	return os << "hits: " << s.hits << ", misses: " << s.misses << ", evictions: " << s.evictions;
+}
+
+namespace sturm_cache
+{
+	/**
+	 * Least recently used cache, mapping pairs of polynomials to shared immutable values.
+	 * Not synchronized by itself.
+	 */
+	template<typename Polynomial, typename Value>
+	class LRUCache {
+		using Key = std::pair<Polynomial, Polynomial>;
+		struct KeyHash {
+			std::size_t operator()(const Key& k) const {
+				std::size_t seed = 0;
+				carl::hash_add(seed, k.first, k.second);
+				return seed;
+			}
+		};
+		using Entry = std::pair<Key, std::shared_ptr<const Value>>;
+		/// Entries, the most recently used one first.
+		std::list<Entry> mEntries;
+		std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> mIndex;
+	public:
+		std::size_t size() const {
+			return mEntries.size();
+		}
+		std::shared_ptr<const Value> find(const Key& key) {
+			auto it = mIndex.find(key);
+			if (it == mIndex.end()) return nullptr;
+			mEntries.splice(mEntries.begin(), mEntries, it->second);
+			return it->second->second;
+		}
+		/// Inserts an entry and returns the number of evicted entries.
+		std::size_t insert(const Key& key, const std::shared_ptr<const Value>& value, std::size_t capacity) {
+			if (mIndex.find(key) != mIndex.end()) return 0;
+			mEntries.emplace_front(key, value);
+			mIndex.emplace(key, mEntries.begin());
+			return shrink(capacity);
+		}
+		/// Removes the least recently used entries until at most capacity entries are left.
+		std::size_t shrink(std::size_t capacity) {
+			std::size_t evicted = 0;
+			while (mEntries.size() > capacity) {
+				mIndex.erase(mEntries.back().first);
+				mEntries.pop_back();
+				evicted++;
+			}
+			return evicted;
+		}
+		void clear() {
+			mIndex.clear();
+			mEntries.clear();
+		}
+	};
+}
+
+/**
+ * Cache for Sturm sequences and principal subresultant coefficients, shared by all users of the same coefficient type.
+ * The values are computed outside of the lock and returned as shared pointers, hence they remain valid when evicted.
+ * Access is synchronized if carl is built with THREAD_SAFE.
+ * @ingroup unirp
+ */
+template<typename Coeff>
+class SturmSequenceCache: public Singleton<SturmSequenceCache<Coeff>>
+{
+	friend Singleton<SturmSequenceCache<Coeff>>;
+public:
+	using Polynomial = UnivariatePolynomial<Coeff>;
+	using Sequence = std::list<Polynomial>;
+	using Coefficients = std::vector<Polynomial>;
+private:
+	/// Maximum number of entries for each kind of value.
+	std::size_t mCapacity = 1000;
+	sturm_cache::LRUCache<Polynomial, Sequence> mSequences;
+	sturm_cache::LRUCache<Polynomial, Coefficients> mCoefficients;
+	SturmSequenceCacheStatistics mStatistics;
+#ifdef THREAD_SAFE
+	mutable std::mutex mMutex;
+	#define STURM_CACHE_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+#else
+	#define STURM_CACHE_LOCK_GUARD
+#endif
+
+	template<typename Value, typename Compute>
+	std::shared_ptr<const Value> lookup(sturm_cache::LRUCache<Polynomial, Value>& cache, const Polynomial& p, const Polynomial& q, Compute&& compute) {
+		auto key = std::make_pair(p, q);
+		{
+			STURM_CACHE_LOCK_GUARD
+			auto res = cache.find(key);
+			if (res != nullptr) {
+				mStatistics.hits++;
+				return res;
+			}
+			mStatistics.misses++;
+		}
+		auto res = std::make_shared<const Value>(compute());
+		STURM_CACHE_LOCK_GUARD
+		mStatistics.evictions += cache.insert(key, res, mCapacity);
+		return res;
+	}
+
+protected:
+	SturmSequenceCache() = default;
+
+public:
+	/**
+	 * Returns the standard Sturm sequence of p.
+	 * @see UnivariatePolynomial::standardSturmSequence()
+	 */
+	std::shared_ptr<const Sequence> sturmSequence(const Polynomial& p) {
+		return sturmSequence(p, p.derivative());
+	}
+	/**
+	 * Returns the signed remainder sequence of p and q.
+	 * @see UnivariatePolynomial::standardSturmSequence(const UnivariatePolynomial&)
+	 */
+	std::shared_ptr<const Sequence> sturmSequence(const Polynomial& p, const Polynomial& q) {
+		return lookup(mSequences, p, q, [&p,&q](){ return p.standardSturmSequence(q); });
+	}
+	/**
+	 * Returns the principal subresultant coefficients of p and q.
+	 * As all strategies yield the same result, the strategy is only used if the value is not cached yet.
+	 * @see carl::principalSubresultantsCoefficients()
+	 */
+	std::shared_ptr<const Coefficients> principalSubresultantsCoefficients(const Polynomial& p, const Polynomial& q, SubresultantStrategy strategy = SubresultantStrategy::Default) {
+		return lookup(mCoefficients, p, q, [&p,&q,strategy](){ return carl::principalSubresultantsCoefficients(p, q, strategy); });
+	}
+
+	std::size_t capacity() const {
+		return mCapacity;
+	}
+	/// Sets the maximum number of entries for each kind of value, evicting entries if necessary.
+	void setCapacity(std::size_t capacity) {
+		STURM_CACHE_LOCK_GUARD
+		mCapacity = capacity;
+		mStatistics.evictions += mSequences.shrink(capacity);
+		mStatistics.evictions += mCoefficients.shrink(capacity);
+	}
+	/// Returns the number of cached values.
+	std::size_t size() const {
+		STURM_CACHE_LOCK_GUARD
+		return mSequences.size() + mCoefficients.size();
+	}
+	SturmSequenceCacheStatistics statistics() const {
+		STURM_CACHE_LOCK_GUARD
+		return mStatistics;
+	}
+	/// Removes all entries and resets the statistics.
+	void clear() {
+		STURM_CACHE_LOCK_GUARD
+		mSequences.clear();
+		mCoefficients.clear();
+		mStatistics = SturmSequenceCacheStatistics();
+	}
+};
+
+}
@@ -9,6 +9,7 @@
 #include "../interval/Interval.h"
 #include "../numbers/numbers.h"
 #include "../util/SFINAE.h"
+#include "AdaptiveCoefficients.h"
 #include "Polynomial.h"
 #include "Sign.h"
 #include "Variable.h"
@@ -27,6 +28,8 @@ namespace carl {
 // Forward declarations
 //
 template<typename Coefficient> class UnivariatePolynomial;
+template<typename Coefficient> class SturmSequenceCache;
+template<typename Coefficient> class ModularSquareFreeDecomposition;
 
 template<typename Coefficient>
 using UnivariatePolynomialPtr = std::shared_ptr<UnivariatePolynomial<Coefficient>>;
@@ -67,8 +70,8 @@ class UnivariatePolynomial : public Polynomial
 private:
 	/// The main variable.
 	Variable mMainVar;
-	/// The coefficients.
-	std::vector<Coefficient> mCoefficients;
+	/// The coefficients, stored densely or sparsely depending on their density.
+	AdaptiveCoefficients<Coefficient> mCoefficients;
 
 public:
 	/**
@@ -385,6 +388,12 @@ public:
 	 */
 	void truncate() {
 		assert(this->mCoefficients.size() > 0);
+		if (this->mCoefficients.isSparse()) {
+			auto terms = this->mCoefficients.terms();
+			terms.pop_back();
+			this->mCoefficients.assignTerms(std::move(terms));
+			return;
+		}
 		this->mCoefficients.resize(this->mCoefficients.size()-1);
 		this->stripLeadingZeroes();
 	}
@@ -394,7 +403,24 @@ public:
 	 * @return Coefficients.
 	 */
 	const std::vector<Coefficient>& coefficients() const {
-		return mCoefficients;
+		return mCoefficients.dense();
+	}
+
+	/**
+	 * Checks whether the coefficients are currently stored sparsely.
+	 * High-degree polynomials with few nonzero coefficients are stored sparsely, until an operation needs the dense coefficients.
+	 * @return If the polynomial is stored sparsely.
+	 */
+	bool isSparse() const {
+		return mCoefficients.isSparse();
+	}
+	/**
+	 * Retrieves the nonzero terms of this polynomial.
+	 * Does not convert a sparse polynomial to the dense representation.
+	 * @return Pairs of exponents and nonzero coefficients, sorted by increasing exponent.
+	 */
+	std::vector<std::pair<std::size_t, Coefficient>> terms() const {
+		return mCoefficients.terms();
 	}
 
 	/**
@@ -738,6 +764,14 @@ public:
 											 UnivariatePolynomial& s, UnivariatePolynomial& t);
 	
 	Coefficient evaluate(const Coefficient& value) const;
+	/**
+	 * Evaluates the polynomial at many points at once.
+	 * Rational points are evaluated on the integral polynomial, other fields use a subproduct tree for large inputs.
+	 * @param points Points to evaluate.
+	 * @return Values at the points, in the same order.
+	 */
+	template<typename C=Coefficient, EnableIf<is_number<C>> = dummy>
+	std::vector<Coefficient> evaluate(const std::vector<Coefficient>& points) const;
 	
 	template<typename C=Coefficient, EnableIf<is_number<C>> = dummy>
 	void substituteIn(Variable var, const Coefficient& value);
@@ -757,9 +791,26 @@ public:
 	carl::Sign sgn(const Coefficient& value) const {
 		return carl::sgn(this->evaluate(value));
 	}
+	/**
+	 * Calculates the signs of the polynomial at many points at once.
+	 * For rational points, no rational number is constructed.
+	 * @param points Points to evaluate.
+	 * @return Signs at the points, in the same order.
+	 */
+	template<typename C=Coefficient, EnableIf<is_number<C>> = dummy>
+	std::vector<carl::Sign> sgn(const std::vector<Coefficient>& points) const;
 	bool isRoot(const Coefficient& value) const {
 		return this->sgn(value) == Sign::ZERO;
 	}
+	/**
+	 * Computes the polynomial of degree less than n that takes the given values at n pairwise distinct points.
+	 * @param var Main variable of the result.
+	 * @param points Pairwise distinct points.
+	 * @param values Values at the points.
+	 * @return Interpolating polynomial.
+	 */
+	template<typename C=Coefficient, EnableIf<is_field<C>> = dummy>
+	static UnivariatePolynomial interpolate(Variable var, const std::vector<Coefficient>& points, const std::vector<Coefficient>& values);
 	
 	template<typename SubstitutionType, typename C = Coefficient, EnableIf<is_instantiation_of<MultivariatePolynomial, C>> = dummy>
 	UnivariatePolynomial<Coefficient> evaluateCoefficient(const std::map<Variable, SubstitutionType>&) const
@@ -1294,3 +1345,6 @@ struct less<carl::UnivariatePolynomial<Coefficient>> {
 }
 
 #include "UnivariatePolynomial.tpp"
+#include "ModularResultant.h"
+#include "SturmSequenceCache.h"
+#include "polynomialfunctions/ModularSquareFree.h"
@@ -15,6 +15,9 @@
 #include "MultivariateGCD.h"
 #include "MultivariatePolynomial.h"
 #include "Sign.h"
+#include "polynomialfunctions/HalfGCD.h"
+#include "polynomialfunctions/MultipointEvaluation.h"
+#include "polynomialfunctions/UnivariateMultiplication.h"
 
 #include <algorithm>
 #include <iomanip>
@@ -62,8 +65,15 @@ UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar)
 template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, const Coeff& coeff, std::size_t degree) :
 mMainVar(mainVar),
-mCoefficients(degree+1, Coeff(0)) // We would like to use 0 here, but Coeff(0) is not always constructable (some methods need more parameter)
+mCoefficients()
 {
+	if(coeff != Coeff(0) && AdaptiveCoefficients<Coeff>::preferSparse(1, degree+1))
+	{
+		mCoefficients.assignTerms({ std::make_pair(degree, coeff) });
+		assert(isConsistent());
+		return;
+	}
+	mCoefficients.resize(degree+1, Coeff(0)); // We would like to use 0 here, but Coeff(0) is not always constructable (some methods need more parameter)
 	if(coeff != Coeff(0))
 	{
 		mCoefficients[degree] = coeff;
@@ -81,6 +91,7 @@ UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, std::initial
 : mMainVar(mainVar), mCoefficients(coefficients)
 {
 	this->stripLeadingZeroes();
+	mCoefficients.adapt();
 	assert(this->isConsistent());
 }
 
@@ -93,6 +104,7 @@ UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, std::initial
 		this->mCoefficients.push_back(Coeff(c));
 	}
 	this->stripLeadingZeroes();
+	mCoefficients.adapt();
 	assert(this->isConsistent());
 }
 
@@ -101,14 +113,16 @@ UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, const std::v
 : mMainVar(mainVar), mCoefficients(coefficients)
 {
 	this->stripLeadingZeroes();
+	mCoefficients.adapt();
 	assert(this->isConsistent());
 }
 
 template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, std::vector<Coeff>&& coefficients)
-: mMainVar(mainVar), mCoefficients(coefficients)
+: mMainVar(mainVar), mCoefficients(std::move(coefficients))
 {
 	this->stripLeadingZeroes();
+	mCoefficients.adapt();
 	assert(this->isConsistent());
 }
 
@@ -116,22 +130,19 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff>::UnivariatePolynomial(Variable mainVar, const std::map<uint, Coeff>& coefficients)
 : mMainVar(mainVar)
 {
-	mCoefficients.reserve(coefficients.rbegin()->first);
+	typename AdaptiveCoefficients<Coeff>::Sparse terms;
 	for (const auto& expAndCoeff : coefficients)
 	{
-		if(expAndCoeff.first != mCoefficients.size() + 1)
-		{
-			mCoefficients.resize(expAndCoeff.first, Coeff(0));
-		}
-		mCoefficients.push_back(expAndCoeff.second);
+		if (expAndCoeff.second != Coeff(0)) terms.emplace_back(expAndCoeff.first, expAndCoeff.second);
 	}
-	this->stripLeadingZeroes();
+	mCoefficients.assignTerms(std::move(terms));
 	assert(this->isConsistent());
 }
 
 template<typename Coeff>
 Coeff UnivariatePolynomial<Coeff>::evaluate(const Coeff& value) const 
 {
+	if (mCoefficients.isSparse()) return sparse_univariate::evaluate(mCoefficients.terms(), value);
 	Coeff result(0);
 	Coeff var(1);
 	for(const Coeff& coeff : mCoefficients)
@@ -142,6 +153,27 @@ Coeff UnivariatePolynomial<Coeff>::evaluate(const Coeff& value) const
 	return result;
 }
 
+template<typename Coeff>
+template<typename C, EnableIf<is_number<C>>>
+std::vector<Coeff> UnivariatePolynomial<Coeff>::evaluate(const std::vector<Coeff>& points) const
+{
+	return multipoint::evaluate(coefficients(), points);
+}
+
+template<typename Coeff>
+template<typename C, EnableIf<is_number<C>>>
+std::vector<Sign> UnivariatePolynomial<Coeff>::sgn(const std::vector<Coeff>& points) const
+{
+	return multipoint::signs(coefficients(), points);
+}
+
+template<typename Coeff>
+template<typename C, EnableIf<is_field<C>>>
+UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::interpolate(Variable var, const std::vector<Coeff>& points, const std::vector<Coeff>& values)
+{
+	return UnivariatePolynomial<Coeff>(var, multipoint::interpolate(points, values));
+}
+
 template<typename Coeff>
 template<typename C, EnableIf<is_number<C>>>
 void UnivariatePolynomial<Coeff>::substituteIn(Variable var, const Coeff& value) {
@@ -224,8 +256,17 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::derivative(uint nth) co
 	if (this->isConstant()) {
 		return result;
 	}
-	result.mCoefficients.reserve(mCoefficients.size()-nth);
 	// nth == 1 is most common case and can be implemented more efficient.
+	if (nth == 1 && mCoefficients.isSparse()) {
+		typename AdaptiveCoefficients<Coeff>::Sparse terms;
+		for (const auto& t: mCoefficients.terms()) {
+			if (t.first > 0) terms.emplace_back(t.first - 1, Coeff(t.first) * t.second);
+		}
+		result.mCoefficients.assignTerms(std::move(terms));
+		result.stripLeadingZeroes();
+		return result;
+	}
+	result.mCoefficients.reserve(mCoefficients.size()-nth);
 	if (nth == 1) {
 		auto it = std::next(mCoefficients.begin());
 		for (std::size_t i = 1; it != mCoefficients.end(); it++, i++) {
@@ -554,6 +595,8 @@ UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::gcd(const UnivariatePol
 	assert(!a.isZero());
 	assert(!b.isZero());
 	assert(a.mainVar() == b.mainVar());
+	UnivariatePolynomial<Coeff> res(a.mainVar());
+	if(half_gcd::fieldGCD(a.mCoefficients.dense(), b.mCoefficients.dense(), res.mCoefficients.dense())) return res;
 	if(a.degree() < b.degree()) return gcd_recursive(b.normalized(),a.normalized()).normalized();
 	else return gcd_recursive(a.normalized(),b.normalized()).normalized();
 }
@@ -819,6 +862,11 @@ DivisionResult<UnivariatePolynomial<Coeff>> UnivariatePolynomial<Coeff>::divideB
 	{
 		return result;
 	}
+	if(univariate_multiplication::fastDivide(mCoefficients.dense(), divisor.mCoefficients.dense(), result.quotient.mCoefficients.dense(), result.remainder.mCoefficients.dense()))
+	{
+		assert(*this == divisor * result.quotient + result.remainder);
+		return result;
+	}
 	result.quotient.mCoefficients.resize(1+mCoefficients.size()-divisor.mCoefficients.size(), Coeff(0));
 	
 	do
@@ -1353,6 +1401,10 @@ CLANG_WARNING_RESET
 	else
 	{
 		assert(!isConstant()); // Othewise, the derivative is zero and the next assertion is thrown.
+		if (degree() >= ModularSquareFreeDecomposition<Coeff>::threshold && ModularSquareFreeDecomposition<Coeff>::calculate(*this, result)) {
+			CARL_LOG_TRACE("carl.core.upoly", "UnivSSF: used the modular decomposition");
+			return result;
+		}
 		UnivariatePolynomial<Coeff> b = this->derivative();
 		CARL_LOG_TRACE("carl.core.upoly", "UnivSSF: b = " << b);
 		UnivariatePolynomial<Coeff> s(mainVar());
@@ -1491,7 +1543,7 @@ int UnivariatePolynomial<Coeff>::countRealRoots(const Interval<Coeff>& interval)
 	assert(!this->isZero());
 	assert(!this->isRoot(interval.lower()));
 	assert(!this->isRoot(interval.upper()));
-	return UnivariatePolynomial<Coeff>::countRealRoots(this->standardSturmSequence(), interval);
+	return UnivariatePolynomial<Coeff>::countRealRoots(*SturmSequenceCache<Coeff>::getInstance().sturmSequence(*this), interval);
 }
 
 template<typename Coeff>
@@ -1537,6 +1589,12 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff> UnivariatePolynomial<Coeff>::operator -() const
 {
 	UnivariatePolynomial result(mMainVar);
+	if (mCoefficients.isSparse()) {
+		auto terms = mCoefficients.terms();
+		for (auto& t: terms) t.second = -t.second;
+		result.mCoefficients.assignTerms(std::move(terms));
+		return result;
+	}
 	result.mCoefficients.reserve(mCoefficients.size());
 	for(auto c : mCoefficients)
 	{
@@ -1576,6 +1634,10 @@ UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator+=(const Univa
 	{
 		return *this;
 	}
+	if (mCoefficients.isSparse() || rhs.mCoefficients.isSparse()) {
+		mCoefficients.assignTerms(sparse_univariate::add(mCoefficients.terms(), rhs.mCoefficients.terms()));
+		return *this;
+	}
 	
 	if(mCoefficients.size() < rhs.mCoefficients.size())
 	{
@@ -1660,6 +1722,12 @@ template<typename Coefficient>
 template<typename C, EnableIf<is_number<C>>>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=(Variable rhs) {
 	if (rhs == this->mMainVar) {
+		if (this->mCoefficients.isSparse()) {
+			auto terms = this->mCoefficients.terms();
+			for (auto& t: terms) t.first++;
+			this->mCoefficients.assignTerms(std::move(terms));
+			return *this;
+		}
 		this->mCoefficients.insert(this->mCoefficients.begin(), Coefficient(0));
 		return *this;
 	}
@@ -1670,6 +1738,12 @@ template<typename Coefficient>
 template<typename C, DisableIf<is_number<C>>>
 UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=(Variable rhs) {
 	if (rhs == this->mMainVar) {
+		if (this->mCoefficients.isSparse()) {
+			auto terms = this->mCoefficients.terms();
+			for (auto& t: terms) t.first++;
+			this->mCoefficients.assignTerms(std::move(terms));
+			return *this;
+		}
 		this->mCoefficients.insert(this->mCoefficients.begin(), Coefficient(0));
 		return *this;
 	}
@@ -1686,6 +1760,15 @@ UnivariatePolynomial<Coefficient>& UnivariatePolynomial<Coefficient>::operator*=
 		mCoefficients.clear();
 		return *this;
 	}
+	if (mCoefficients.isSparse()) {
+		auto terms = mCoefficients.terms();
+		for (auto& t: terms) t.second *= rhs;
+		if (is_finite<Coefficient>::value) {
+			terms.erase(std::remove_if(terms.begin(), terms.end(), [](const auto& t){ return t.second == Coefficient(0); }), terms.end());
+		}
+		mCoefficients.assignTerms(std::move(terms));
+		return *this;
+	}
 	for(Coefficient& c : mCoefficients)
 	{
 		c *= rhs;
@@ -1710,6 +1793,12 @@ UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const typen
 		mCoefficients.clear();
 		return *this;
 	}
+	if (mCoefficients.isSparse()) {
+		auto terms = mCoefficients.terms();
+		for (auto& t: terms) t.second *= rhs;
+		mCoefficients.assignTerms(std::move(terms));
+		return *this;
+	}
 	for(Coeff& c : mCoefficients)
 	{
 		c *= rhs;
@@ -1727,19 +1816,13 @@ UnivariatePolynomial<Coeff>& UnivariatePolynomial<Coeff>::operator*=(const Univa
 		return *this;
 	}
 	
-	std::vector<Coeff> newCoeffs; 
-	newCoeffs.reserve(mCoefficients.size() + rhs.mCoefficients.size());
-	for(std::size_t e = 0; e < mCoefficients.size() + rhs.degree(); ++e)
-	{
-		newCoeffs.push_back(Coeff(0));
-		for(std::size_t i = 0; i < mCoefficients.size() && i <= e; ++i)
-		{
-			if(e - i < rhs.mCoefficients.size())
-			{
-				newCoeffs.back() += mCoefficients[i] * rhs.mCoefficients[e-i];
-			}
-		}
+	if(isZero()) return *this;
+	if (mCoefficients.isSparse() || rhs.mCoefficients.isSparse()) {
+		mCoefficients.assignTerms(sparse_univariate::multiply(mCoefficients.terms(), rhs.mCoefficients.terms()));
+		return *this;
 	}
+	
+	std::vector<Coeff> newCoeffs = univariate_multiplication::multiply(mCoefficients.dense(), rhs.mCoefficients.dense());
 	mCoefficients.swap(newCoeffs);
 	stripLeadingZeroes();
 	return *this;
@@ -5,6 +5,7 @@
 #include "../../converter/OldGinacConverter.h"
 #include "../../numbers/FunctionSelector.h"
 #include "../../util/Common.h"
+#include "MultivariateFactorization.h"
 
 namespace carl {
 
@@ -44,11 +45,39 @@ namespace helper {
 		CARL_LOG_WARN("carl.core.factorize", reference << " -> " << factors);
 		factors = trivialFactorization(reference);
 	}
+
+	/**
+	 * Factorizes a polynomial with rational coefficients using the native MultivariateFactorization.
+	 */
+	template<typename O, typename P>
+	Factors<MultivariatePolynomial<mpq_class,O,P>> nativeFactorization(const MultivariatePolynomial<mpq_class,O,P>& p, bool includeConstants) {
+		return MultivariateFactorization<mpq_class,O,P>()(p, includeConstants);
+	}
+	/**
+	 * Factorizes a polynomial with integral coefficients using the native MultivariateFactorization.
+	 * As all factors are primitive integral polynomials, the factorization is computed over the rationals and converted back.
+	 */
+	template<typename O, typename P>
+	Factors<MultivariatePolynomial<mpz_class,O,P>> nativeFactorization(const MultivariatePolynomial<mpz_class,O,P>& p, bool includeConstants) {
+		typename MultivariatePolynomial<mpq_class,O,P>::TermsType terms;
+		for (const auto& t: p) terms.emplace_back(mpq_class(t.coeff()), t.monomial());
+		Factors<MultivariatePolynomial<mpz_class,O,P>> res;
+		for (const auto& f: nativeFactorization(MultivariatePolynomial<mpq_class,O,P>(std::move(terms), false, true), includeConstants)) {
+			typename MultivariatePolynomial<mpz_class,O,P>::TermsType iterms;
+			for (const auto& t: f.first) {
+				assert(carl::isInteger(t.coeff()));
+				iterms.emplace_back(getNum(t.coeff()), t.monomial());
+			}
+			res.emplace(MultivariatePolynomial<mpz_class,O,P>(std::move(iterms), false, true), f.second);
+		}
+		return res;
+	}
 }
 
 /**
- * Try to factorize a multivariate polynomial..
+ * Try to factorize a multivariate polynomial.
  * Uses CoCoALib and GiNaC, if available, depending on the coefficient type of the polynomial.
+ * Otherwise, the native MultivariateFactorization is used for integral and rational coefficients.
  */
 template<typename C, typename O, typename P>
 Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomial<C,O,P>& p, bool includeConstants = true) {
@@ -69,8 +98,8 @@ Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomia
 		[includeConstants](const auto& p){ CoCoAAdaptor<MultivariatePolynomial<C,O,P>> c({p}); return c.factorize(p, includeConstants); },
 		[includeConstants](const auto& p){ CoCoAAdaptor<MultivariatePolynomial<C,O,P>> c({p}); return c.factorize(p, includeConstants); }
 	#else
-		[includeConstants](const auto& p){ return helper::trivialFactorization(p); },
-		[includeConstants](const auto& p){ return helper::trivialFactorization(p); }
+		[includeConstants](const auto& p){ return helper::nativeFactorization(p, includeConstants); },
+		[includeConstants](const auto& p){ return helper::nativeFactorization(p, includeConstants); }
 	#endif
 	#if defined USE_GINAC
 		,
@@ -0,0 +1,287 @@
+/**
+ * @file   HalfGCD.h
+ * @ingroup gcd
+ * @ingroup unirp
+ *
+ * Subquadratic gcd computation for univariate polynomials over prime fields by the half-gcd method
+ * (@cite GG13, Algorithm 11.4, in the formulation of Thull and Yap).
+ * The algorithms work on dense coefficient vectors and are parametrized by the field arithmetic:
+ * GFNumber coefficients modulo a word-sized prime are mapped to plain integers in a contiguous array,
+ * other prime fields are handled directly on GFNumber objects.
+ */
+
+#pragma once
+
+#include "../ModularArithmetic.h"
+#include "../../numbers/GFNumber.h"
+#include "../../util/SFINAE.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+namespace half_gcd
+{
+	/// Polynomials with fewer coefficients are handled by the Euclidean algorithm.
+	constexpr std::size_t hgcd_threshold = 48;
+	/// Operands with fewer coefficients are multiplied by the schoolbook method.
+	constexpr std::size_t karatsuba_threshold = 24;
+
+	/// Arithmetic modulo a prime below \f$2^{31}\f$, on plain integers in \f$[0, p)\f$.
+	struct WordField {
+		using Element = std::uint64_t;
+		std::uint64_t p;
+		Element zero() const { return 0; }
+		Element one() const { return 1; }
+		bool isZero(Element a) const { return a == 0; }
+		Element add(Element a, Element b) const { return modular_gcd::addmod(a, b, p); }
+		Element sub(Element a, Element b) const { return modular_gcd::submod(a, b, p); }
+		Element mul(Element a, Element b) const { return modular_gcd::mulmod(a, b, p); }
+		Element inv(Element a) const { return modular_gcd::invmod(a, p); }
+	};
+
+	/// Arithmetic on GFNumber objects of a prime field.
+	template<typename Integer>
+	struct GaloisFieldArithmetic {
+		using Element = GFNumber<Integer>;
+		const GaloisField<Integer>* gf;
+		Element zero() const { return Element(Integer(0), gf); }
+		Element one() const { return Element(Integer(1), gf); }
+		bool isZero(const Element& a) const { return a.isZero(); }
+		Element add(const Element& a, const Element& b) const { return a + b; }
+		Element sub(const Element& a, const Element& b) const { return a - b; }
+		Element mul(const Element& a, const Element& b) const { return a * b; }
+		Element inv(const Element& a) const { return a.inverse(); }
+	};
+
+	/// Dense polynomial without leading zeros, index i holds the coefficient of \f$x^i\f$.
+	template<typename Field>
+	using Poly = std::vector<typename Field::Element>;
+
+	template<typename Field>
+	void strip(const Field& f, Poly<Field>& a) {
+		while (!a.empty() && f.isZero(a.back())) a.pop_back();
+	}
+	/// Degree of a, where the zero polynomial has degree -1.
+	template<typename Field>
+	long degree(const Poly<Field>& a) {
+		return long(a.size()) - 1;
+	}
+	template<typename Field>
+	Poly<Field> subtract(const Field& f, const Poly<Field>& a, const Poly<Field>& b) {
+		Poly<Field> res(a);
+		if (res.size() < b.size()) res.resize(b.size(), f.zero());
+		for (std::size_t i = 0; i < b.size(); i++) res[i] = f.sub(res[i], b[i]);
+		strip(f, res);
+		return res;
+	}
+	template<typename Field>
+	Poly<Field> add(const Field& f, const Poly<Field>& a, const Poly<Field>& b) {
+		Poly<Field> res(a);
+		if (res.size() < b.size()) res.resize(b.size(), f.zero());
+		for (std::size_t i = 0; i < b.size(); i++) res[i] = f.add(res[i], b[i]);
+		strip(f, res);
+		return res;
+	}
+	/// Returns a divided by \f$x^k\f$, dropping the lower coefficients.
+	template<typename Field>
+	Poly<Field> shift(const Poly<Field>& a, std::size_t k) {
+		if (k >= a.size()) return Poly<Field>();
+		return Poly<Field>(a.begin() + long(k), a.end());
+	}
+
+	/// Adds a * b to res, where res has at least na + nb - 1 entries.
+	template<typename Field>
+	void karatsuba(const Field& f, const typename Field::Element* a, std::size_t na, const typename Field::Element* b, std::size_t nb, typename Field::Element* res) {
+		if (na < nb) return karatsuba(f, b, nb, a, na, res);
+		if (nb < karatsuba_threshold) {
+			for (std::size_t i = 0; i < na; i++) {
+				if (f.isZero(a[i])) continue;
+				for (std::size_t j = 0; j < nb; j++) res[i+j] = f.add(res[i+j], f.mul(a[i], b[j]));
+			}
+			return;
+		}
+		if (na > nb) {
+			for (std::size_t i = 0; i < na; i += nb) {
+				karatsuba(f, a + i, std::min(nb, na - i), b, nb, res + i);
+			}
+			return;
+		}
+		std::size_t h = na / 2;
+		std::size_t l = na - h;
+		Poly<Field> z0(2*h - 1, f.zero());
+		Poly<Field> z1(2*l - 1, f.zero());
+		Poly<Field> z2(2*l - 1, f.zero());
+		karatsuba(f, a, h, b, h, z0.data());
+		karatsuba(f, a + h, l, b + h, l, z2.data());
+		Poly<Field> sa(a + h, a + na);
+		Poly<Field> sb(b + h, b + na);
+		for (std::size_t i = 0; i < h; i++) {
+			sa[i] = f.add(sa[i], a[i]);
+			sb[i] = f.add(sb[i], b[i]);
+		}
+		karatsuba(f, sa.data(), l, sb.data(), l, z1.data());
+		for (std::size_t i = 0; i < z0.size(); i++) {
+			res[i] = f.add(res[i], z0[i]);
+			z1[i] = f.sub(z1[i], z0[i]);
+		}
+		for (std::size_t i = 0; i < z2.size(); i++) {
+			res[2*h + i] = f.add(res[2*h + i], z2[i]);
+			z1[i] = f.sub(z1[i], z2[i]);
+		}
+		for (std::size_t i = 0; i < z1.size(); i++) {
+			res[h + i] = f.add(res[h + i], z1[i]);
+		}
+	}
+	template<typename Field>
+	Poly<Field> multiply(const Field& f, const Poly<Field>& a, const Poly<Field>& b) {
+		if (a.empty() || b.empty()) return Poly<Field>();
+		Poly<Field> res(a.size() + b.size() - 1, f.zero());
+		karatsuba(f, a.data(), a.size(), b.data(), b.size(), res.data());
+		strip(f, res);
+		return res;
+	}
+	/// Computes quotient and remainder of a divided by a nonzero b.
+	template<typename Field>
+	void divide(const Field& f, const Poly<Field>& a, const Poly<Field>& b, Poly<Field>& quotient, Poly<Field>& remainder) {
+		assert(!b.empty());
+		remainder = a;
+		if (a.size() < b.size()) {
+			quotient.clear();
+			return;
+		}
+		quotient.assign(a.size() - b.size() + 1, f.zero());
+		auto inv = f.inv(b.back());
+		for (std::size_t i = quotient.size(); i-- > 0; ) {
+			auto factor = f.mul(remainder[i + b.size() - 1], inv);
+			quotient[i] = factor;
+			if (f.isZero(factor)) continue;
+			for (std::size_t j = 0; j < b.size(); j++) {
+				remainder[i+j] = f.sub(remainder[i+j], f.mul(factor, b[j]));
+			}
+		}
+		strip(f, remainder);
+	}
+
+	/// Transformation matrix \f$((m_{00}, m_{01}), (m_{10}, m_{11}))\f$ on pairs of polynomials.
+	template<typename Field>
+	struct Matrix {
+		Poly<Field> m00;
+		Poly<Field> m01;
+		Poly<Field> m10;
+		Poly<Field> m11;
+		static Matrix identity(const Field& f) {
+			return Matrix({Poly<Field>({f.one()}), Poly<Field>(), Poly<Field>(), Poly<Field>({f.one()})});
+		}
+		/// Replaces (a, b) by the image under this matrix.
+		void apply(const Field& f, Poly<Field>& a, Poly<Field>& b) const {
+			Poly<Field> na = add(f, multiply(f, m00, a), multiply(f, m01, b));
+			b = add(f, multiply(f, m10, a), multiply(f, m11, b));
+			a = std::move(na);
+		}
+		/// Returns this * rhs.
+		Matrix compose(const Field& f, const Matrix& rhs) const {
+			return Matrix({
+				add(f, multiply(f, m00, rhs.m00), multiply(f, m01, rhs.m10)),
+				add(f, multiply(f, m00, rhs.m01), multiply(f, m01, rhs.m11)),
+				add(f, multiply(f, m10, rhs.m00), multiply(f, m11, rhs.m10)),
+				add(f, multiply(f, m10, rhs.m01), multiply(f, m11, rhs.m11))
+			});
+		}
+	};
+
+	/**
+	 * Computes a matrix M of remainder sequence steps such that M (a, b) = (c, d) with
+	 * \f$deg(c) \geq m > deg(d)\f$ for \f$m = \lceil deg(a) / 2 \rceil\f$.
+	 * Assumes that deg(a) > deg(b).
+	 */
+	template<typename Field>
+	Matrix<Field> hgcd(const Field& f, const Poly<Field>& a, const Poly<Field>& b) {
+		assert(degree<Field>(a) > degree<Field>(b));
+		std::size_t m = a.size() / 2;
+		if (degree<Field>(b) < long(m)) return Matrix<Field>::identity(f);
+		Matrix<Field> r = hgcd(f, shift<Field>(a, m), shift<Field>(b, m));
+		Poly<Field> c(a);
+		Poly<Field> d(b);
+		r.apply(f, c, d);
+		if (degree<Field>(d) < long(m)) return r;
+		Poly<Field> q;
+		Poly<Field> rem;
+		divide(f, c, d, q, rem);
+		Poly<Field> negq = subtract(f, Poly<Field>(), q);
+		Matrix<Field> step({Poly<Field>(), Poly<Field>({f.one()}), Poly<Field>({f.one()}), negq});
+		r = step.compose(f, r);
+		std::size_t k = std::size_t(std::max(0l, 2*long(m) - degree<Field>(d)));
+		return hgcd(f, shift<Field>(d, k), shift<Field>(rem, k)).compose(f, r);
+	}
+
+	/// Computes the monic gcd of a and b.
+	template<typename Field>
+	Poly<Field> gcd(const Field& f, Poly<Field> a, Poly<Field> b) {
+		if (a.size() < b.size()) std::swap(a, b);
+		while (!b.empty()) {
+			Poly<Field> q;
+			Poly<Field> r;
+			divide(f, a, b, q, r);
+			a = std::move(b);
+			b = std::move(r);
+			if (b.size() >= hgcd_threshold) {
+				hgcd(f, a, b).apply(f, a, b);
+			}
+		}
+		if (!a.empty()) {
+			auto inv = f.inv(a.back());
+			for (auto& c: a) c = f.mul(c, inv);
+		}
+		return a;
+	}
+
+	/**
+	 * Computes the monic gcd of two coefficient vectors of GFNumber objects by the half-gcd method.
+	 * Prime fields of word size use plain integer arithmetic.
+	 * @return false if the polynomials are too small or the coefficients do not belong to a prime field.
+	 */
+	template<typename Coeff, EnableIf<is_instantiation_of<GFNumber, Coeff>> = dummy>
+	bool fieldGCD(const std::vector<Coeff>& a, const std::vector<Coeff>& b, std::vector<Coeff>& result) {
+		using Integer = typename IntegralType<Coeff>::type;
+		if (std::min(a.size(), b.size()) < hgcd_threshold) return false;
+		const GaloisField<Integer>* gf = a.back().gf();
+		if (gf == nullptr || gf->k() != 1) return false;
+		if (gf->p() > modular_gcd::max_prime) {
+			GaloisFieldArithmetic<Integer> f({gf});
+			auto convert = [gf](const std::vector<Coeff>& v){
+				std::vector<Coeff> res;
+				res.reserve(v.size());
+				for (const auto& c: v) res.emplace_back(c.representingInteger(), gf);
+				return res;
+			};
+			result = gcd(f, convert(a), convert(b));
+			return true;
+		}
+		WordField f({gf->p()});
+		Integer ip = Integer(carl::sint(gf->p()));
+		auto convert = [&ip](const std::vector<Coeff>& v){
+			std::vector<std::uint64_t> res;
+			res.reserve(v.size());
+			for (const auto& c: v) {
+				Integer r = carl::mod(c.representingInteger(), ip);
+				if (carl::isNegative(r)) r += ip;
+				res.push_back(toInt<carl::uint>(r));
+			}
+			return res;
+		};
+		std::vector<std::uint64_t> g = gcd(f, convert(a), convert(b));
+		result.clear();
+		result.reserve(g.size());
+		for (const auto& c: g) result.emplace_back(Integer(carl::sint(c)), gf);
+		return true;
+	}
+	template<typename Coeff, DisableIf<is_instantiation_of<GFNumber, Coeff>> = dummy>
+	bool fieldGCD(const std::vector<Coeff>&, const std::vector<Coeff>&, std::vector<Coeff>&) {
+		return false;
+	}
+}
+}
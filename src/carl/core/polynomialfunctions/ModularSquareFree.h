@@ -0,0 +1,232 @@
+/**
+ * @file   ModularSquareFree.h
+ * @ingroup unirp
+ *
+ * Modular square-free decomposition of univariate polynomials over the integers and the rationals.
+ * Yun's algorithm is applied to the images modulo several word-sized primes, using the dense arithmetic of the half-gcd implementation.
+ * The images are combined by Chinese remaindering and the result is verified by multiplying the factors.
+ * This avoids the coefficient growth of Yun's algorithm over the rationals.
+ */
+
+#pragma once
+
+#include "HalfGCD.h"
+#include "../ModularArithmetic.h"
+#include "../UnivariatePolynomial.h"
+#include "../logging.h"
+
+#include <cassert>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+namespace modular_sqfree
+{
+	using Field = half_gcd::WordField;
+	using ModPoly = half_gcd::Poly<Field>;
+	using ModularFactors = std::vector<std::pair<ModPoly, uint>>;
+
+	inline ModPoly derivative(const Field& f, const ModPoly& a) {
+		ModPoly res;
+		for (std::size_t i = 1; i < a.size(); i++) res.push_back(f.mul(a[i], i % f.p));
+		half_gcd::strip(f, res);
+		return res;
+	}
+	/// Exact division of a by b.
+	inline ModPoly quotient(const Field& f, const ModPoly& a, const ModPoly& b) {
+		ModPoly q;
+		ModPoly r;
+		half_gcd::divide(f, a, b, q, r);
+		assert(r.empty());
+		return q;
+	}
+
+	/**
+	 * Computes the square-free decomposition of a monic polynomial over \f$Z_p\f$ using Yun's algorithm.
+	 * The prime must be larger than the degree of a.
+	 * @return Monic, square-free, pairwise coprime factors with their multiplicities.
+	 * @see @cite GG99, Algorithm 14.21
+	 */
+	inline ModularFactors yun(const Field& f, const ModPoly& a) {
+		assert(a.size() <= f.p);
+		ModularFactors res;
+		ModPoly da = derivative(f, a);
+		ModPoly g = half_gcd::gcd(f, a, da);
+		ModPoly b = quotient(f, a, g);
+		ModPoly d = half_gcd::subtract(f, quotient(f, da, g), derivative(f, b));
+		for (uint i = 1; b.size() > 1; i++) {
+			g = half_gcd::gcd(f, b, d);
+			b = quotient(f, b, g);
+			d = half_gcd::subtract(f, quotient(f, d, g), derivative(f, b));
+			if (g.size() > 1) res.emplace_back(g, i);
+		}
+		return res;
+	}
+
+	/// Degree of \f$gcd(a, a')\f$ for the given decomposition of a. It is minimal for lucky primes.
+	inline std::size_t defect(const ModularFactors& factors) {
+		std::size_t res = 0;
+		for (const auto& fac: factors) res += (fac.second - 1) * (fac.first.size() - 1);
+		return res;
+	}
+
+	/**
+	 * Computes the square-free decomposition of a primitive integral polynomial.
+	 * @param f Polynomial with positive leading coefficient and positive degree.
+	 * @param result Primitive, square-free, pairwise coprime factors with positive leading coefficients
+	 * and their multiplicities, such that their product is f.
+	 * @return If the computation succeeded.
+	 */
+	template<typename Integer>
+	bool decompose(const UnivariatePolynomial<Integer>& f, std::vector<std::pair<UnivariatePolynomial<Integer>, uint>>& result) {
+		assert(f.degree() > 0 && carl::isPositive(f.lcoeff()));
+		const Integer& lc = f.lcoeff();
+		// The coefficients of lc(f) times a monic factor of f are bounded by lc(f) * 2^deg(f) * |f|_1.
+		Integer bound = 0;
+		for (const auto& c: f.coefficients()) bound += carl::abs(c);
+		bound *= lc;
+		for (std::size_t i = 0; i <= f.degree(); i++) bound *= 2;
+
+		std::vector<std::pair<std::vector<Integer>, uint>> candidate;
+		std::size_t bestDefect = 0;
+		Integer modulus = 0;
+		std::uint64_t prime = modular_gcd::max_prime + 1;
+		// Use at most a few thousand primes, which is beyond anything reasonable.
+		for (std::size_t iteration = 0; iteration < 4096; iteration++) {
+			prime = modular_gcd::previousPrime(prime);
+			if (prime <= f.degree()) break;
+			Integer ip = Integer(carl::sint(prime));
+			if (carl::isZero(carl::mod(lc, ip))) continue;
+			Field field{prime};
+			auto reduce = [&ip](const Integer& n) {
+				Integer r = carl::mod(n, ip);
+				if (carl::isNegative(r)) r += ip;
+				return std::uint64_t(toInt<carl::uint>(r));
+			};
+			std::uint64_t l = reduce(lc);
+			std::uint64_t linv = field.inv(l);
+			ModPoly fp;
+			for (const auto& c: f.coefficients()) fp.push_back(field.mul(reduce(c), linv));
+			ModularFactors factors = yun(field, fp);
+			std::size_t d = defect(factors);
+			if (d == 0) {
+				// f is square-free.
+				result.clear();
+				result.emplace_back(f, 1);
+				return true;
+			}
+			if (!candidate.empty() && d > bestDefect) continue; // Unlucky prime.
+			for (auto& fac: factors) {
+				for (auto& c: fac.first) c = field.mul(c, l);
+			}
+			if (candidate.empty() || d < bestDefect) {
+				candidate.clear();
+				for (const auto& fac: factors) {
+					std::vector<Integer> coeffs;
+					for (const auto& c: fac.first) {
+						coeffs.push_back(c > prime / 2 ? Integer(carl::sint(c)) - ip : Integer(carl::sint(c)));
+					}
+					candidate.emplace_back(std::move(coeffs), fac.second);
+				}
+				bestDefect = d;
+				modulus = ip;
+			} else {
+				if (factors.size() != candidate.size()) continue;
+				bool compatible = true;
+				for (std::size_t i = 0; i < factors.size(); i++) {
+					compatible = compatible && factors[i].second == candidate[i].second && factors[i].first.size() == candidate[i].first.size();
+				}
+				if (!compatible) continue;
+				// Chinese remaindering of candidate (mod modulus) and the images (mod prime).
+				bool changed = false;
+				Integer newModulus = modulus * ip;
+				Integer halfModulus = carl::quotient(newModulus, Integer(2));
+				std::uint64_t inv = field.inv(reduce(modulus));
+				for (std::size_t i = 0; i < factors.size(); i++) {
+					auto& coeffs = candidate[i].first;
+					for (std::size_t j = 0; j < coeffs.size(); j++) {
+						std::uint64_t delta = field.sub(factors[i].first[j], reduce(coeffs[j]));
+						if (delta == 0) continue;
+						changed = true;
+						coeffs[j] += modulus * Integer(carl::sint(field.mul(delta, inv)));
+						if (coeffs[j] > halfModulus) coeffs[j] -= newModulus;
+					}
+				}
+				modulus = newModulus;
+				if (changed && modulus <= bound * 2) continue;
+			}
+			// Verify the candidate: the primitive parts multiply to f.
+			std::vector<std::pair<UnivariatePolynomial<Integer>, uint>> factorization;
+			UnivariatePolynomial<Integer> product(f.mainVar(), Integer(1));
+			for (const auto& fac: candidate) {
+				Integer content = 0;
+				for (const auto& c: fac.first) content = carl::gcd(content, c);
+				std::vector<Integer> coeffs;
+				for (const auto& c: fac.first) coeffs.push_back(carl::div(c, content));
+				if (carl::isNegative(coeffs.back())) {
+					for (auto& c: coeffs) c = -c;
+				}
+				factorization.emplace_back(UnivariatePolynomial<Integer>(f.mainVar(), coeffs), fac.second);
+				product *= factorization.back().first.pow(fac.second);
+			}
+			if (product == f) {
+				CARL_LOG_DEBUG("carl.core.sqfree", "Modular square-free decomposition of " << f << " used " << (iteration + 1) << " primes");
+				result = std::move(factorization);
+				return true;
+			}
+		}
+		CARL_LOG_WARN("carl.core.sqfree", "Modular square-free decomposition of " << f << " did not converge.");
+		return false;
+	}
+}
+
+/**
+ * Computes square-free decompositions of univariate polynomials with rational coefficients by modular methods.
+ * For other coefficient types, the computation always fails.
+ * @ingroup unirp
+ */
+template<typename Coeff>
+class ModularSquareFreeDecomposition
+{
+public:
+	/// Degree from which the modular algorithm is preferred over Yun's algorithm over the rationals.
+	static constexpr std::size_t threshold = 16;
+
+	/**
+	 * Computes the square-free decomposition of p.
+	 * The factors are primitive integral polynomials with positive leading coefficients, except for the factor with multiplicity one
+	 * that also holds the constant factor. Hence, the product of the factors is p.
+	 * @param p Non-constant polynomial.
+	 * @param result Square-free factors indexed by their multiplicities.
+	 * @return If the computation succeeded.
+	 */
+	template<typename C = Coeff, EnableIf<is_subset_of_rationals<C>> = dummy>
+	static bool calculate(const UnivariatePolynomial<Coeff>& p, std::map<uint, UnivariatePolynomial<Coeff>>& result) {
+		using Integer = typename IntegralType<Coeff>::type;
+		assert(!p.isConstant());
+		UnivariatePolynomial<Integer> f = p.coprimeCoefficients();
+		if (carl::isNegative(f.lcoeff())) f = -f;
+		std::vector<std::pair<UnivariatePolynomial<Integer>, uint>> factors;
+		if (!modular_sqfree::decompose(f, factors)) return false;
+		result.clear();
+		for (const auto& fac: factors) {
+			result.emplace(fac.second, fac.first.template convert<Coeff>());
+		}
+		Coeff constant = p.lcoeff() / Coeff(f.lcoeff());
+		if (!carl::isOne(constant)) {
+			auto it = result.find(1);
+			if (it == result.end()) result.emplace(1, UnivariatePolynomial<Coeff>(p.mainVar(), constant));
+			else it->second *= constant;
+		}
+		return true;
+	}
+	template<typename C = Coeff, DisableIf<is_subset_of_rationals<C>> = dummy>
+	static bool calculate(const UnivariatePolynomial<Coeff>&, std::map<uint, UnivariatePolynomial<Coeff>>&) {
+		return false;
+	}
+};
+
+}
@@ -0,0 +1,251 @@
+/**
+ * @file   MultipointEvaluation.h
+ * @ingroup unirp
+ *
+ * Evaluation of a univariate polynomial at many points and interpolation from many points,
+ * both based on the subproduct tree of the points (@cite GG13, Section 10.1).
+ * As the coefficients grow quickly over the rationals, the subproduct tree is only used for exact fields with coefficients of fixed size.
+ * Rational points are instead handled one by one on the integral polynomial, with a single division for every point.
+ * Smaller inputs are evaluated by Horner's scheme.
+ */
+
+#pragma once
+
+#include "UnivariateMultiplication.h"
+#include "../Sign.h"
+#include "../../numbers/numbers.h"
+#include "../../util/SFINAE.h"
+
+#include <cassert>
+#include <type_traits>
+#include <vector>
+
+namespace carl
+{
+namespace multipoint
+{
+	/// Batches with fewer points or polynomials of smaller size are evaluated by Horner's scheme. Over \f$Z_p\f$, the tree only pays off for large inputs.
+	constexpr std::size_t tree_threshold = 2048;
+
+	/// Dense coefficient vector, index i holds the coefficient of \f$x^i\f$.
+	template<typename Coeff>
+	using Dense = std::vector<Coeff>;
+
+	template<typename Coeff>
+	void strip(Dense<Coeff>& a) {
+		while (!a.empty() && carl::isZero(a.back())) a.pop_back();
+	}
+
+	/// Computes the remainder of a modulo the monic polynomial b.
+	template<typename Coeff>
+	Dense<Coeff> remainder(const Dense<Coeff>& a, const Dense<Coeff>& b) {
+		assert(!b.empty() && carl::isOne(b.back()));
+		if (a.size() < b.size()) return a;
+		Dense<Coeff> quotient;
+		Dense<Coeff> res;
+		if (univariate_multiplication::fastDivide(a, b, quotient, res)) return res;
+		res = a;
+		std::size_t n = b.size() - 1;
+		for (std::size_t i = res.size() - 1; i >= n && i < res.size(); i--) {
+			if (carl::isZero(res[i])) continue;
+			Coeff c = res[i];
+			for (std::size_t j = 0; j <= n; j++) res[i - n + j] -= c * b[j];
+		}
+		res.resize(n);
+		strip(res);
+		return res;
+	}
+
+	/// Evaluates a at the given point by Horner's scheme.
+	template<typename Coeff>
+	Coeff horner(const Dense<Coeff>& a, const Coeff& point) {
+		Coeff res(0);
+		for (auto it = a.rbegin(); it != a.rend(); ++it) {
+			res = res * point + *it;
+		}
+		return res;
+	}
+
+	/**
+	 * Subproduct tree of a sequence of points \f$a_0, \dots, a_{n-1}\f$ from a field.
+	 * The leaves are the linear polynomials \f$x - a_i\f$, every inner node is the product of its children.
+	 */
+	template<typename Coeff>
+	class SubproductTree {
+		/// Nodes by level, starting with the leaves. Node i of a level is the parent of the nodes 2i and 2i+1 of the level below.
+		std::vector<std::vector<Dense<Coeff>>> mLevels;
+	public:
+		explicit SubproductTree(const std::vector<Coeff>& points) {
+			assert(!points.empty());
+			mLevels.emplace_back();
+			for (const auto& a: points) mLevels.back().push_back(Dense<Coeff>({-a, Coeff(1)}));
+			while (mLevels.back().size() > 1) {
+				const auto& nodes = mLevels.back();
+				std::vector<Dense<Coeff>> parents;
+				for (std::size_t i = 0; i + 1 < nodes.size(); i += 2) {
+					parents.push_back(univariate_multiplication::multiply(nodes[i], nodes[i+1]));
+				}
+				if (nodes.size() % 2 == 1) parents.push_back(nodes.back());
+				mLevels.push_back(std::move(parents));
+			}
+		}
+
+		/// Returns \f$\prod_i (x - a_i)\f$.
+		const Dense<Coeff>& root() const {
+			return mLevels.back().front();
+		}
+
+		/// Evaluates p at all points by computing the remainders modulo all nodes from the root to the leaves.
+		std::vector<Coeff> evaluate(const Dense<Coeff>& p) const {
+			std::vector<Dense<Coeff>> remainders({ remainder(p, root()) });
+			for (std::size_t level = mLevels.size() - 1; level-- > 0; ) {
+				const auto& nodes = mLevels[level];
+				std::vector<Dense<Coeff>> next;
+				next.reserve(nodes.size());
+				for (std::size_t i = 0; i < nodes.size(); i++) {
+					next.push_back(remainder(remainders[i / 2], nodes[i]));
+				}
+				remainders = std::move(next);
+			}
+			std::vector<Coeff> res;
+			res.reserve(remainders.size());
+			for (const auto& r: remainders) res.push_back(r.empty() ? Coeff(0) : r.front());
+			return res;
+		}
+
+		/// Computes \f$\sum_i c_i \cdot \prod_{j \neq i} (x - a_j)\f$ from the leaves to the root.
+		Dense<Coeff> linearCombination(const std::vector<Coeff>& c) const {
+			assert(c.size() == mLevels.front().size());
+			std::vector<Dense<Coeff>> combinations;
+			for (const auto& ci: c) combinations.push_back(Dense<Coeff>({ci}));
+			for (std::size_t level = 0; level + 1 < mLevels.size(); level++) {
+				const auto& nodes = mLevels[level];
+				std::vector<Dense<Coeff>> next;
+				for (std::size_t i = 0; i + 1 < nodes.size(); i += 2) {
+					Dense<Coeff> left = univariate_multiplication::multiply(combinations[i], nodes[i+1]);
+					Dense<Coeff> right = univariate_multiplication::multiply(combinations[i+1], nodes[i]);
+					if (left.size() < right.size()) std::swap(left, right);
+					for (std::size_t j = 0; j < right.size(); j++) left[j] += right[j];
+					next.push_back(std::move(left));
+				}
+				if (nodes.size() % 2 == 1) next.push_back(combinations.back());
+				combinations = std::move(next);
+			}
+			Dense<Coeff> res = std::move(combinations.front());
+			strip(res);
+			return res;
+		}
+	};
+
+	/// The subproduct tree is only used for exact fields with coefficients of fixed size, as the coefficient growth dominates over the rationals.
+	template<typename Coeff>
+	struct use_tree: std::integral_constant<bool, is_field<Coeff>::value && !is_rational<Coeff>::value && !is_float<Coeff>::value> {};
+
+	/// Integral polynomial \f$d \cdot a\f$ for the smallest positive integer d.
+	template<typename Coeff, typename Integer = typename IntegralType<Coeff>::type>
+	std::vector<Integer> integral(const Dense<Coeff>& a, Integer& denominator) {
+		denominator = 1;
+		for (const auto& c: a) denominator = carl::lcm(denominator, getDenom(c));
+		std::vector<Integer> res;
+		res.reserve(a.size());
+		for (const auto& c: a) res.push_back(getNum(c * Coeff(denominator)));
+		return res;
+	}
+	/**
+	 * Evaluates the homogenization of the nonempty integral polynomial a at (num, den), that is \f$den^n \cdot a(num/den)\f$.
+	 * @param power Is set to \f$den^n\f$.
+	 */
+	template<typename Integer>
+	Integer homogeneous(const std::vector<Integer>& a, const Integer& num, const Integer& den, Integer& power) {
+		Integer res = a.back();
+		power = 1;
+		for (std::size_t i = a.size() - 1; i-- > 0; ) {
+			power *= den;
+			res *= num;
+			if (!carl::isZero(a[i])) res += a[i] * power;
+		}
+		return res;
+	}
+
+	/// Evaluates a at all points. Rational points are handled on integers, with a single division for every point.
+	template<typename Coeff, EnableIf<is_rational<Coeff>> = dummy>
+	std::vector<Coeff> evaluate(const Dense<Coeff>& a, const std::vector<Coeff>& points) {
+		using Integer = typename IntegralType<Coeff>::type;
+		if (a.empty()) return std::vector<Coeff>(points.size(), Coeff(0));
+		Integer denominator;
+		std::vector<Integer> coeffs = integral(a, denominator);
+		std::vector<Coeff> res;
+		res.reserve(points.size());
+		Integer power;
+		for (const auto& p: points) {
+			Integer value = homogeneous(coeffs, getNum(p), getDenom(p), power);
+			res.push_back(Coeff(value) / Coeff(denominator * power));
+		}
+		return res;
+	}
+	/// Evaluates a at all points, using the subproduct tree for many points.
+	template<typename Coeff, EnableIf<use_tree<Coeff>> = dummy>
+	std::vector<Coeff> evaluate(const Dense<Coeff>& a, const std::vector<Coeff>& points) {
+		if (points.size() >= tree_threshold && a.size() >= tree_threshold) {
+			return SubproductTree<Coeff>(points).evaluate(a);
+		}
+		std::vector<Coeff> res;
+		res.reserve(points.size());
+		for (const auto& p: points) res.push_back(horner(a, p));
+		return res;
+	}
+	template<typename Coeff, DisableIf<is_rational<Coeff>, use_tree<Coeff>> = dummy>
+	std::vector<Coeff> evaluate(const Dense<Coeff>& a, const std::vector<Coeff>& points) {
+		std::vector<Coeff> res;
+		res.reserve(points.size());
+		for (const auto& p: points) res.push_back(horner(a, p));
+		return res;
+	}
+
+	/**
+	 * Computes the polynomial of degree less than n that takes the given values at the n pairwise distinct points.
+	 * @see @cite GG13, Algorithm 10.11
+	 */
+	template<typename Coeff>
+	Dense<Coeff> interpolate(const std::vector<Coeff>& points, const std::vector<Coeff>& values) {
+		assert(points.size() == values.size());
+		if (points.empty()) return Dense<Coeff>();
+		SubproductTree<Coeff> tree(points);
+		const Dense<Coeff>& m = tree.root();
+		Dense<Coeff> derivative;
+		for (std::size_t i = 1; i < m.size(); i++) derivative.push_back(m[i] * Coeff(carl::sint(i)));
+		std::vector<Coeff> weights = tree.evaluate(derivative);
+		for (std::size_t i = 0; i < weights.size(); i++) {
+			assert(!carl::isZero(weights[i]));
+			weights[i] = values[i] / weights[i];
+		}
+		return tree.linearCombination(weights);
+	}
+
+	/**
+	 * Determines the signs of a at all points.
+	 * For rational coefficients, a is made integral and \f$b^n \cdot a(p/b)\f$ is evaluated for every point \f$p/b\f$ on integers.
+	 */
+	template<typename Coeff, EnableIf<is_rational<Coeff>> = dummy>
+	std::vector<Sign> signs(const Dense<Coeff>& a, const std::vector<Coeff>& points) {
+		using Integer = typename IntegralType<Coeff>::type;
+		if (a.empty()) return std::vector<Sign>(points.size(), Sign::ZERO);
+		Integer denominator;
+		std::vector<Integer> coeffs = integral(a, denominator);
+		std::vector<Sign> res;
+		res.reserve(points.size());
+		Integer power;
+		for (const auto& p: points) {
+			res.push_back(carl::sgn(homogeneous(coeffs, getNum(p), getDenom(p), power)));
+		}
+		return res;
+	}
+	template<typename Coeff, DisableIf<is_rational<Coeff>> = dummy>
+	std::vector<Sign> signs(const Dense<Coeff>& a, const std::vector<Coeff>& points) {
+		std::vector<Sign> res;
+		res.reserve(points.size());
+		for (const auto& value: evaluate(a, points)) res.push_back(carl::sgn(value));
+		return res;
+	}
+}
+}
@@ -0,0 +1,420 @@
+/**
+ * @file MultivariateFactorization.h
+ * @ingroup multirp
+ *
+ * Native factorization of multivariate polynomials over the rationals.
+ * The polynomial is first decomposed into square-free parts using Yun's algorithm.
+ * Every square-free part is then made primitive with respect to a main variable,
+ * all other variables are specialized to integers, the resulting univariate polynomial is factored
+ * (see UnivariateFactorization.h) and the univariate factors are lifted back
+ * by multivariate Hensel lifting with imposed leading coefficients (@cite GCL92, Chapter 6).
+ * Spurious univariate factors are handled by recombination, just like in the univariate case.
+ */
+
+#pragma once
+
+#include "../carlLogging.h"
+#include "../MultivariateGCD.h"
+#include "../MultivariatePolynomial.h"
+#include "../../util/Common.h"
+#include "UnivariateFactorization.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Native factorization of multivariate polynomials with coefficients from a field of characteristic zero, i.e. the rationals.
+ * The computed factors are primitive integral polynomials with positive leading coefficients.
+ */
+template<typename Coeff, typename Ordering, typename Policies>
+class MultivariateFactorization {
+	static_assert(is_field<Coeff>::value, "MultivariateFactorization requires field coefficients.");
+	using Polynomial = MultivariatePolynomial<Coeff,Ordering,Policies>;
+	using Integer = typename IntegralType<Coeff>::type;
+	using Dense = std::vector<Coeff>;
+
+	/// Variables different from the main variable, in the order they are lifted.
+	std::vector<Variable> mOthers;
+	/// Degree bounds for the variables in mOthers.
+	std::vector<std::size_t> mBounds;
+	/// Main variable for the current lifting.
+	Variable mMain;
+	/// Cofactor of the second univariate factor in the extended gcd of the univariate factors.
+	Dense mS;
+
+	static Polynomial divide(const Polynomial& a, const Polynomial& b) {
+		Polynomial res;
+		bool exact = a.divideBy(b, res);
+		assert(exact);
+		return res;
+	}
+	/// Computes the content of p with respect to the variable v.
+	static Polynomial content(const Polynomial& p, Variable v) {
+		Polynomial res;
+		for (std::size_t i = 0; i <= p.degree(v); i++) {
+			Polynomial c = p.coeff(v, i);
+			if (c.isZero()) continue;
+			if (res.isZero()) res = c;
+			else res = carl::gcd(res, c);
+			if (res.isConstant()) return Polynomial(Coeff(1));
+		}
+		return res;
+	}
+	static Polynomial power(Variable v, std::size_t exp) {
+		return Polynomial(Term<Coeff>(Coeff(1), v, uint(exp)));
+	}
+	/// Removes all terms that exceed the degree bound of one of the first n variables in mOthers.
+	Polynomial truncate(const Polynomial& p, std::size_t n) const {
+		typename Polynomial::TermsType terms;
+		for (const auto& t: p) {
+			bool keep = true;
+			if (t.monomial()) {
+				for (std::size_t i = 0; i < n; i++) {
+					if (t.monomial()->exponentOfVariable(mOthers[i]) > mBounds[i]) {
+						keep = false;
+						break;
+					}
+				}
+			}
+			if (keep) terms.push_back(t);
+		}
+		return Polynomial(std::move(terms), false, false);
+	}
+
+	/// @name Dense univariate arithmetic over the rationals in the main variable.
+	/// @{
+	Dense toDense(const Polynomial& p) const {
+		Dense res(p.degree(mMain) + 1, Coeff(0));
+		for (const auto& t: p) {
+			assert(!t.monomial() || t.monomial()->nrVariables() == 1);
+			res[t.monomial() ? t.monomial()->exponentOfVariable(mMain) : 0] += t.coeff();
+		}
+		zassenhaus::strip(res);
+		return res;
+	}
+	Polynomial fromDense(const Dense& p) const {
+		typename Polynomial::TermsType terms;
+		for (std::size_t i = 0; i < p.size(); i++) {
+			if (carl::isZero(p[i])) continue;
+			if (i == 0) terms.emplace_back(p[i]);
+			else terms.emplace_back(p[i], mMain, uint(i));
+		}
+		return Polynomial(std::move(terms), false, false);
+	}
+	/// Divides a by b, stores the remainder in a and returns the quotient.
+	static Dense divide(Dense& a, const Dense& b) {
+		if (a.size() < b.size()) return Dense();
+		Dense q(a.size() - b.size() + 1, Coeff(0));
+		for (std::size_t i = a.size(); i >= b.size(); i--) {
+			if (carl::isZero(a[i-1])) continue;
+			Coeff c = a[i-1] / b.back();
+			std::size_t shift = i - b.size();
+			q[shift] = c;
+			for (std::size_t j = 0; j < b.size(); j++) a[shift+j] -= c * b[j];
+		}
+		zassenhaus::strip(a);
+		return q;
+	}
+	/// Computes s and t such that s*a + t*b = gcd(a,b), where the gcd is monic. Returns the gcd.
+	static Dense extendedGCD(const Dense& a, const Dense& b, Dense& s, Dense& t) {
+		Dense r0(a), r1(b);
+		Dense s0({Coeff(1)}), s1;
+		Dense t0, t1({Coeff(1)});
+		while (!r1.empty()) {
+			Dense q = divide(r0, r1);
+			std::swap(r0, r1);
+			Dense s2 = zassenhaus::add(s0, zassenhaus::multiply(q, s1), Coeff(-1));
+			Dense t2 = zassenhaus::add(t0, zassenhaus::multiply(q, t1), Coeff(-1));
+			s0 = std::move(s1); s1 = std::move(s2);
+			t0 = std::move(t1); t1 = std::move(t2);
+		}
+		Coeff inv = Coeff(1) / r0.back();
+		for (auto& c: r0) c *= inv;
+		for (auto& c: s0) c *= inv;
+		for (auto& c: t0) c *= inv;
+		s = std::move(s0);
+		t = std::move(t0);
+		return r0;
+	}
+	/// @}
+
+	/**
+	 * Solves s*h + t*g = c for s and t with deg(s) < deg(g) modulo the ideal given by the degree bounds of the first n variables of mOthers.
+	 * g and h are the current factors, specialized at zero for all but the first n variables.
+	 * @see @cite GCL92, Algorithm 6.2
+	 */
+	std::pair<Polynomial,Polynomial> diophant(const Polynomial& g, const Polynomial& h, const Polynomial& c, std::size_t n) const {
+		if (n == 0) {
+			Dense cd = toDense(c);
+			Dense s = zassenhaus::multiply(mS, cd);
+			Dense gd = toDense(g);
+			divide(s, gd);
+			Dense t = zassenhaus::add(cd, zassenhaus::multiply(s, toDense(h)), Coeff(-1));
+			Dense q = divide(t, gd);
+			assert(t.empty());
+			return std::make_pair(fromDense(s), fromDense(q));
+		}
+		Variable v = mOthers[n-1];
+		Polynomial g0 = g.coeff(v, 0);
+		Polynomial h0 = h.coeff(v, 0);
+		auto res = diophant(g0, h0, c.coeff(v, 0), n - 1);
+		Polynomial e = truncate(c - res.first * h - res.second * g, n);
+		for (std::size_t m = 1; m <= mBounds[n-1] && !e.isZero(); m++) {
+			Polynomial cm = e.coeff(v, m);
+			if (cm.isZero()) continue;
+			auto delta = diophant(g0, h0, cm, n - 1);
+			Polynomial vm = power(v, m);
+			delta.first *= vm;
+			delta.second *= vm;
+			res.first += delta.first;
+			res.second += delta.second;
+			e = truncate(e - delta.first * h - delta.second * g, n);
+		}
+		return res;
+	}
+
+	/// Replaces the leading coefficient of p with respect to the main variable by lc.
+	Polynomial imposeLeadingCoefficient(const Polynomial& p, const Polynomial& lc) const {
+		Polynomial xd = power(mMain, p.degree(mMain));
+		return p - p.lcoeff(mMain) * xd + lc * xd;
+	}
+
+	/**
+	 * Lifts the factorization f(x,0,...,0) = g0 * h0 * const to a factorization of f.
+	 * f is primitive with respect to the main variable and g0 and h0 are coprime.
+	 * @param f Polynomial, shifted such that the evaluation point is zero.
+	 * @param g0 First univariate factor.
+	 * @param h0 Second univariate factor.
+	 * @param g Lifted first factor, primitive with respect to the main variable.
+	 * @param h Cofactor f / g.
+	 * @return If g0 and h0 are images of true factors of f.
+	 */
+	bool lift(const Polynomial& f, const Polynomial& g0, const Polynomial& h0, Polynomial& g, Polynomial& h) {
+		Polynomial lc = f.lcoeff(mMain);
+		Polynomial lcAtZero = lc;
+		for (auto v: mOthers) lcAtZero = lcAtZero.coeff(v, 0);
+		Coeff lc0 = lcAtZero.constantPart();
+		assert(!carl::isZero(lc0));
+		Polynomial u = f * lc;
+		Polynomial G = g0 * Coeff(lc0 / g0.lcoeff(mMain).constantPart());
+		Polynomial H = h0 * Coeff(lc0 / h0.lcoeff(mMain).constantPart());
+		Dense t;
+		Dense gcd = extendedGCD(toDense(H), toDense(G), mS, t);
+		assert(gcd.size() == 1);
+		mBounds.clear();
+		for (auto v: mOthers) mBounds.push_back(u.degree(v));
+
+		for (std::size_t j = 0; j < mOthers.size(); j++) {
+			Variable v = mOthers[j];
+			Polynomial uj = u;
+			Polynomial lcj = lc;
+			for (std::size_t k = j + 1; k < mOthers.size(); k++) {
+				uj = uj.coeff(mOthers[k], 0);
+				lcj = lcj.coeff(mOthers[k], 0);
+			}
+			G = imposeLeadingCoefficient(G, lcj);
+			H = imposeLeadingCoefficient(H, lcj);
+			Polynomial G0 = G.coeff(v, 0);
+			Polynomial H0 = H.coeff(v, 0);
+			Polynomial e = uj - G * H;
+			for (std::size_t m = 1; m <= mBounds[j] && !e.isZero(); m++) {
+				Polynomial c = e.coeff(v, m);
+				if (c.isZero()) continue;
+				auto delta = diophant(G0, H0, c, j);
+				Polynomial vm = power(v, m);
+				G += truncate(delta.first, j) * vm;
+				H += truncate(delta.second, j) * vm;
+				e = uj - G * H;
+			}
+			if (!e.isZero()) return false;
+		}
+		G = divide(G, content(G, mMain));
+		if (!f.divideBy(G, h)) return false;
+		g = G;
+		return true;
+	}
+
+	/// Factors a polynomial that is square-free, primitive with respect to x and has at least two variables.
+	void factorPrimitive(const Polynomial& f, Variable x, std::vector<Polynomial>& res) {
+		mMain = x;
+		mOthers.clear();
+		for (auto v: f.gatherVariables()) {
+			if (v != x) mOthers.push_back(v);
+		}
+		Polynomial lc = f.lcoeff(x);
+		Polynomial df = f.derivative(x);
+
+		// Search for a good evaluation point.
+		std::mt19937 rand(0);
+		std::map<Variable, Polynomial> point;
+		Polynomial image;
+		std::size_t attempt = 0;
+		for (; attempt < 1000; attempt++) {
+			int range = int(attempt / 8 + 1);
+			std::uniform_int_distribution<int> dist(-range, range);
+			point.clear();
+			for (auto v: mOthers) point.emplace(v, Polynomial(Coeff(attempt == 0 ? 0 : dist(rand))));
+			if (lc.substitute(point).isZero()) continue;
+			image = f.substitute(point);
+			Dense s, t;
+			if (extendedGCD(toDense(image), toDense(df.substitute(point)), s, t).size() == 1) break;
+		}
+		if (attempt == 1000) {
+			CARL_LOG_WARN("carl.core.factorize", "Did not find a good evaluation point for " << f);
+			res.push_back(f);
+			return;
+		}
+		CARL_LOG_DEBUG("carl.core.factorize", "Evaluating " << f << " at " << point);
+
+		zassenhaus::IntUnivariate<Integer> dense;
+		for (const auto& c: toDense(image.coprimeCoefficients())) dense.push_back(getNum(c));
+		std::vector<Polynomial> factors;
+		for (const auto& fac: zassenhaus::factor(dense)) {
+			Dense d;
+			for (const auto& c: fac) d.emplace_back(c);
+			factors.push_back(fromDense(d));
+		}
+		if (factors.size() == 1) {
+			res.push_back(f);
+			return;
+		}
+
+		// Shift the evaluation point to zero.
+		std::map<Variable, Polynomial> shift;
+		std::map<Variable, Polynomial> unshift;
+		for (const auto& p: point) {
+			shift.emplace(p.first, Polynomial(p.first) + p.second);
+			unshift.emplace(p.first, Polynomial(p.first) - p.second);
+		}
+		Polynomial rest = f.substitute(shift);
+
+		// Recombination: lift subsets of the univariate factors of increasing size.
+		std::size_t size = 1;
+		while (2 * size <= factors.size()) {
+			bool found = false;
+			std::vector<std::size_t> subset(size);
+			for (std::size_t i = 0; i < size; i++) subset[i] = i;
+			while (true) {
+				Polynomial g0(Coeff(1));
+				Polynomial h0(Coeff(1));
+				for (std::size_t i = 0, j = 0; i < factors.size(); i++) {
+					if (j < size && subset[j] == i) {
+						g0 *= factors[i];
+						j++;
+					} else {
+						h0 *= factors[i];
+					}
+				}
+				Polynomial g, h;
+				if (lift(rest, g0, h0, g, h)) {
+					res.push_back(g.substitute(unshift));
+					rest = h;
+					for (auto it = subset.rbegin(); it != subset.rend(); ++it) {
+						factors.erase(factors.begin() + long(*it));
+					}
+					found = true;
+					break;
+				}
+				std::size_t i = size;
+				while (i > 0 && subset[i-1] == factors.size() - size + i - 1) i--;
+				if (i == 0) break;
+				subset[i-1]++;
+				for (std::size_t j = i; j < size; j++) subset[j] = subset[j-1] + 1;
+			}
+			if (!found) size++;
+		}
+		res.push_back(rest.substitute(unshift));
+	}
+
+	/// Factors a square-free polynomial.
+	void factorSquareFree(const Polynomial& p, std::vector<Polynomial>& res) {
+		if (p.isConstant()) return;
+		if (p.totalDegree() == 1) {
+			res.push_back(p);
+			return;
+		}
+		std::set<Variable> vars = p.gatherVariables();
+		Variable x = *vars.begin();
+		for (auto v: vars) {
+			if (p.degree(v) < p.degree(x)) x = v;
+		}
+		Polynomial c = content(p, x);
+		Polynomial f = p;
+		if (!c.isConstant()) {
+			factorSquareFree(c, res);
+			f = divide(p, c);
+		}
+		if (f.degree(x) == 1) {
+			res.push_back(f);
+		} else if (vars.size() == 1) {
+			mMain = x;
+			zassenhaus::IntUnivariate<Integer> dense;
+			for (const auto& coeff: toDense(f.coprimeCoefficients())) dense.push_back(getNum(coeff));
+			for (const auto& fac: zassenhaus::factor(dense)) {
+				Dense d;
+				for (const auto& coeff: fac) d.emplace_back(coeff);
+				res.push_back(fromDense(d));
+			}
+		} else {
+			factorPrimitive(f, x, res);
+		}
+	}
+
+public:
+	/**
+	 * Computes the square-free decomposition of p using Yun's algorithm.
+	 * The result contains pairs of square-free, pairwise coprime polynomials and their multiplicities,
+	 * whose product equals p up to a constant factor.
+	 * @see @cite GG99, Algorithm 14.21
+	 */
+	static std::vector<std::pair<Polynomial,uint>> squareFreeDecomposition(const Polynomial& p) {
+		std::vector<std::pair<Polynomial,uint>> res;
+		if (p.isConstant()) return res;
+		Variable v = *p.gatherVariables().begin();
+		Polynomial c = content(p, v);
+		Polynomial f = divide(p, c);
+		Polynomial df = f.derivative(v);
+		Polynomial a = carl::gcd(f, df);
+		Polynomial b = divide(f, a);
+		Polynomial d = divide(df, a) - b.derivative(v);
+		for (uint i = 1; !b.isConstant(); i++) {
+			a = d.isZero() ? b : carl::gcd(b, d);
+			b = divide(b, a);
+			d = divide(d, a) - b.derivative(v);
+			if (!a.isConstant()) res.emplace_back(a, i);
+		}
+		auto cres = squareFreeDecomposition(c);
+		res.insert(res.end(), cres.begin(), cres.end());
+		return res;
+	}
+
+	/**
+	 * Computes the factorization of p into irreducible factors.
+	 * @param p Polynomial.
+	 * @param includeConstants If the constant factor shall be part of the result.
+	 * @return Irreducible factors and their multiplicities.
+	 */
+	Factors<Polynomial> operator()(const Polynomial& p, bool includeConstants = true) {
+		Factors<Polynomial> res;
+		Polynomial product(Coeff(1));
+		for (const auto& sqf: squareFreeDecomposition(p)) {
+			std::vector<Polynomial> factors;
+			factorSquareFree(sqf.first, factors);
+			for (const auto& f: factors) {
+				Polynomial factor = f.coprimeCoefficients();
+				res[factor] += sqf.second;
+				product *= factor.pow(sqf.second);
+			}
+		}
+		Coeff constant = p.lcoeff() / product.lcoeff();
+		if (includeConstants && !carl::isOne(constant)) {
+			res.emplace(Polynomial(constant), 1);
+		}
+		return res;
+	}
+};
+
+}
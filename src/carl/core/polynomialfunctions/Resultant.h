@@ -4,8 +4,13 @@
 #include <vector>
 
 namespace carl {
+/**
+ * Strategies for the computation of subresultants and resultants.
+ * Modular computes resultants by evaluation, interpolation and chinese remaindering if the coefficients support this
+ * (see ModularResultant) and behaves like Default otherwise, in particular for the full subresultant sequence.
+ */
 enum class SubresultantStrategy {
-	Generic, Lazard, Ducos, Default = Lazard
+	Generic, Lazard, Ducos, Modular, Default = Lazard
 };
 
 template<typename Coeff>
@@ -19,6 +24,19 @@ template<typename Coeff>
 UnivariatePolynomial<Coeff> resultant(const UnivariatePolynomial<Coeff>&, const UnivariatePolynomial<Coeff>&, SubresultantStrategy = SubresultantStrategy::Default);
 template<typename Coeff>
 UnivariatePolynomial<Coeff> discriminant(const UnivariatePolynomial<Coeff>&, SubresultantStrategy = SubresultantStrategy::Default);
+
+namespace helper {
+	/**
+	 * Computes the resultant of two polynomials of positive degree with SubresultantStrategy::Modular.
+	 * Returns false if this is not supported for the coefficient type, specializations are provided in ModularResultant.h.
+	 */
+	template<typename Coeff, typename = void>
+	struct ModularResultant {
+		bool operator()(const UnivariatePolynomial<Coeff>&, const UnivariatePolynomial<Coeff>&, UnivariatePolynomial<Coeff>&) const {
+			return false;
+		}
+	};
+}
 }
 
 #include "../UnivariatePolynomial.h"
@@ -45,6 +63,7 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 	 */
 	assert(pol1.mainVar() == pol2.mainVar());
 	CARL_LOG_TRACE("carl.core.resultant", "subresultants(" << pol1 << ", " << pol2 << ")");
+	if (strategy == SubresultantStrategy::Modular) strategy = SubresultantStrategy::Default;
 	std::list<UnivariatePolynomial<Coeff>> subresultants;
 	Variable variable = pol1.mainVar();
 	
@@ -276,6 +295,15 @@ UnivariatePolynomial<Coeff> resultant(
 ) {
 	assert(p.mainVar() == q.mainVar());
 	if (p.isZero() || q.isZero()) return UnivariatePolynomial<Coeff>(p.mainVar());
+	if (strategy == SubresultantStrategy::Modular && p.degree() > 0 && q.degree() > 0) {
+		UnivariatePolynomial<Coeff> resultant(p.mainVar());
+		// subresultants() swaps the arguments such that the first one has the larger degree, hence we do the same.
+		const UnivariatePolynomial<Coeff>& first = (p.degree() < q.degree()) ? q : p;
+		const UnivariatePolynomial<Coeff>& second = (p.degree() < q.degree()) ? p : q;
+		if (helper::ModularResultant<Coeff>()(first.normalized(), second.normalized(), resultant)) {
+			return resultant;
+		}
+	}
 	UnivariatePolynomial<Coeff> resultant = subresultants(p.normalized(), q.normalized(), strategy).front();
 	CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << resultant);
 	if (resultant.isConstant()) {
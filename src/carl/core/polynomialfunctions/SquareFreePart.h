@@ -5,9 +5,49 @@
 #include "../logging.h"
 #include "../MultivariatePolynomial.h"
 #include "../UnivariatePolynomial.h"
+#include "MultivariateFactorization.h"
+
+#include <map>
+#include <set>
 
 namespace carl {
 
+template<typename Coeff, EnableIf<is_subset_of_rationals<Coeff>> = dummy>
+UnivariatePolynomial<Coeff> squareFreePart(const UnivariatePolynomial<Coeff>& p) {
+	CARL_LOG_DEBUG("carl.core.sqfree", "SquareFreePart of " << p);
+	if (p.isZero()) return p;
+	if (p.isLinearInMainVar()) return p;
+	UnivariatePolynomial<Coeff> normalized = p.coprimeCoefficients().template convert<Coeff>();
+	if (normalized.degree() >= ModularSquareFreeDecomposition<Coeff>::threshold) {
+		std::map<uint, UnivariatePolynomial<Coeff>> factors;
+		if (ModularSquareFreeDecomposition<Coeff>::calculate(normalized, factors)) {
+			UnivariatePolynomial<Coeff> res(p.mainVar(), Coeff(1));
+			for (const auto& f: factors) res *= f.second;
+			return res;
+		}
+	}
+	return normalized.divideBy(UnivariatePolynomial<Coeff>::gcd(normalized, normalized.derivative())).quotient;
+}
+
+namespace modular_sqfree {
+	/**
+	 * Computes the square-free part of a multivariate polynomial over the rationals without CoCoA.
+	 * Polynomials in a single variable use the modular decomposition, all others Yun's algorithm based on the modular gcd.
+	 */
+	template<typename C, typename O, typename P>
+	MultivariatePolynomial<C,O,P> squareFreePart(const MultivariatePolynomial<C,O,P>& p) {
+		std::set<Variable> vars = p.gatherVariables();
+		if (vars.size() == 1) {
+			return MultivariatePolynomial<C,O,P>(carl::squareFreePart(p.toUnivariatePolynomial()));
+		}
+		MultivariatePolynomial<C,O,P> res(C(1));
+		for (const auto& f: MultivariateFactorization<C,O,P>::squareFreeDecomposition(p)) {
+			res *= f.first;
+		}
+		return res;
+	}
+}
+
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> squareFreePart(const MultivariatePolynomial<C,O,P>& p) {
 	CARL_LOG_DEBUG("carl.core.sqfree", "SquareFreePart of " << p);
@@ -28,7 +68,7 @@ MultivariatePolynomial<C,O,P> squareFreePart(const MultivariatePolynomial<C,O,P>
 		[](const auto& p){ CoCoAAdaptor<MultivariatePolynomial<C,O,P>> c({p}); return c.squareFreePart(p); }
 	#else
 		[](const auto& p){ return p; },
-		[](const auto& p){ return p; }
+		[](const auto& p){ return modular_sqfree::squareFreePart(p); }
 	#endif
 	#if defined USE_GINAC
 		,
@@ -39,15 +79,6 @@ MultivariatePolynomial<C,O,P> squareFreePart(const MultivariatePolynomial<C,O,P>
 	return s(p);
 }
 
-template<typename Coeff, EnableIf<is_subset_of_rationals<Coeff>> = dummy>
-UnivariatePolynomial<Coeff> squareFreePart(const UnivariatePolynomial<Coeff>& p) {
-	CARL_LOG_DEBUG("carl.core.sqfree", "SquareFreePart of " << p);
-	if (p.isZero()) return p;
-	if (p.isLinearInMainVar()) return p;
-	UnivariatePolynomial<Coeff> normalized = p.coprimeCoefficients().template convert<Coeff>();
-	return normalized.divideBy(UnivariatePolynomial<Coeff>::gcd(normalized, normalized.derivative())).quotient;
-}
-
 template<typename Coeff, DisableIf<is_subset_of_rationals<Coeff>> = dummy>
 UnivariatePolynomial<Coeff> squareFreePart(const UnivariatePolynomial<Coeff>& p) {
 	CARL_LOG_DEBUG("carl.core.sqfree", "SquareFreePart of " << p);
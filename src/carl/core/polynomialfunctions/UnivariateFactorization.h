@@ -0,0 +1,394 @@
+/**
+ * @file UnivariateFactorization.h
+ * @ingroup unirp
+ *
+ * Native factorization of square-free univariate polynomials over the integers.
+ * We follow the classical Zassenhaus approach (@cite GCL92, Chapter 8):
+ * the polynomial is factored modulo a word-sized prime with the algorithm of Cantor and Zassenhaus,
+ * the modular factors are lifted by quadratic Hensel lifting and the true factors are
+ * recovered by recombination and trial division.
+ */
+
+#pragma once
+
+#include "../carlLogging.h"
+#include "../ModularGCD.h"
+#include "../../numbers/numbers.h"
+
+#include <random>
+#include <vector>
+
+namespace carl {
+namespace zassenhaus {
+	using modular_gcd::ModUnivariate;
+
+	/// @name Arithmetic in Z_p[x] needed for the modular factorization
+	/// @{
+	inline ModUnivariate subtract(const ModUnivariate& a, const ModUnivariate& b, std::uint64_t p) {
+		ModUnivariate res(a);
+		if (res.size() < b.size()) res.resize(b.size(), 0);
+		for (std::size_t i = 0; i < b.size(); i++) res[i] = modular_gcd::submod(res[i], b[i], p);
+		modular_gcd::strip(res);
+		return res;
+	}
+	inline ModUnivariate remainder(const ModUnivariate& a, const ModUnivariate& m, std::uint64_t p) {
+		ModUnivariate res(a);
+		modular_gcd::divide(res, m, p);
+		return res;
+	}
+	inline ModUnivariate derivative(const ModUnivariate& a, std::uint64_t p) {
+		if (a.size() <= 1) return ModUnivariate();
+		ModUnivariate res(a.size() - 1);
+		for (std::size_t i = 1; i < a.size(); i++) res[i-1] = modular_gcd::mulmod(a[i], i % p, p);
+		modular_gcd::strip(res);
+		return res;
+	}
+	/// Computes a^e mod m for an arbitrary precision exponent e.
+	template<typename Integer>
+	ModUnivariate power(const ModUnivariate& a, Integer e, const ModUnivariate& m, std::uint64_t p) {
+		ModUnivariate res({1});
+		ModUnivariate base = remainder(a, m, p);
+		while (!carl::isZero(e)) {
+			if (!carl::isZero(carl::mod(e, Integer(2)))) res = remainder(modular_gcd::multiply(res, base, p), m, p);
+			base = remainder(modular_gcd::multiply(base, base, p), m, p);
+			e = carl::quotient(e, Integer(2));
+		}
+		return res;
+	}
+	/**
+	 * Computes s and t such that s*a + t*b = 1, assuming that a and b are coprime.
+	 */
+	inline void extendedGCD(const ModUnivariate& a, const ModUnivariate& b, std::uint64_t p, ModUnivariate& s, ModUnivariate& t) {
+		ModUnivariate r0(a), r1(b);
+		ModUnivariate s0({1}), s1;
+		ModUnivariate t0, t1({1});
+		while (!r1.empty()) {
+			ModUnivariate q = modular_gcd::divide(r0, r1, p);
+			std::swap(r0, r1);
+			ModUnivariate s2 = subtract(s0, modular_gcd::multiply(q, s1, p), p);
+			ModUnivariate t2 = subtract(t0, modular_gcd::multiply(q, t1, p), p);
+			s0 = std::move(s1); s1 = std::move(s2);
+			t0 = std::move(t1); t1 = std::move(t2);
+		}
+		assert(r0.size() == 1);
+		std::uint64_t inv = modular_gcd::invmod(r0[0], p);
+		s = modular_gcd::scale(s0, inv, p);
+		t = modular_gcd::scale(t0, inv, p);
+	}
+	/// @}
+
+	/**
+	 * Splits a monic square-free polynomial whose irreducible factors all have degree d.
+	 * Implements the equal-degree factorization of Cantor and Zassenhaus for odd p.
+	 */
+	template<typename Integer>
+	void equalDegreeFactorization(const ModUnivariate& g, std::size_t d, std::uint64_t p, std::mt19937& rand, std::vector<ModUnivariate>& res) {
+		if (g.size() - 1 == d) {
+			res.push_back(g);
+			return;
+		}
+		Integer e = carl::div(Integer(carl::pow(Integer(carl::sint(p)), d)) - Integer(1), Integer(2));
+		std::uniform_int_distribution<std::uint64_t> dist(0, p - 1);
+		while (true) {
+			ModUnivariate a(g.size() - 1);
+			for (auto& c: a) c = dist(rand);
+			modular_gcd::strip(a);
+			if (a.size() <= 1) continue;
+			ModUnivariate b = subtract(power(a, e, g, p), ModUnivariate({1}), p);
+			ModUnivariate c = modular_gcd::gcd(g, b, p);
+			if (c.size() > 1 && c.size() < g.size()) {
+				ModUnivariate rest(g);
+				ModUnivariate other = modular_gcd::divide(rest, c, p);
+				equalDegreeFactorization<Integer>(c, d, p, rand, res);
+				equalDegreeFactorization<Integer>(other, d, p, rand, res);
+				return;
+			}
+		}
+	}
+
+	/**
+	 * Computes the monic irreducible factors of a monic square-free polynomial over \f$Z_p\f$ for an odd prime p.
+	 * Combines distinct-degree and equal-degree factorization.
+	 */
+	template<typename Integer>
+	std::vector<ModUnivariate> factorModP(const ModUnivariate& f, std::uint64_t p) {
+		assert(p > 2);
+		std::vector<ModUnivariate> res;
+		std::mt19937 rand(f.size());
+		ModUnivariate rest(f);
+		ModUnivariate x({0, 1});
+		ModUnivariate h = remainder(x, rest, p);
+		for (std::size_t d = 1; 2 * d < rest.size(); d++) {
+			h = power(h, Integer(carl::sint(p)), rest, p);
+			ModUnivariate g = modular_gcd::gcd(rest, subtract(h, x, p), p);
+			if (g.size() > 1) {
+				equalDegreeFactorization<Integer>(g, d, p, rand, res);
+				rest = modular_gcd::divide(rest, g, p);
+				h = remainder(h, rest, p);
+			}
+		}
+		if (rest.size() > 1) res.push_back(rest);
+		return res;
+	}
+
+	/// @name Dense univariate arithmetic over the integers
+	/// @{
+	template<typename Integer>
+	using IntUnivariate = std::vector<Integer>;
+
+	template<typename Integer>
+	void strip(IntUnivariate<Integer>& a) {
+		while (!a.empty() && carl::isZero(a.back())) a.pop_back();
+	}
+	template<typename Integer>
+	IntUnivariate<Integer> multiply(const IntUnivariate<Integer>& a, const IntUnivariate<Integer>& b) {
+		if (a.empty() || b.empty()) return IntUnivariate<Integer>();
+		IntUnivariate<Integer> res(a.size() + b.size() - 1, Integer(0));
+		for (std::size_t i = 0; i < a.size(); i++) {
+			if (carl::isZero(a[i])) continue;
+			for (std::size_t j = 0; j < b.size(); j++) res[i+j] += a[i] * b[j];
+		}
+		return res;
+	}
+	template<typename Integer>
+	IntUnivariate<Integer> add(const IntUnivariate<Integer>& a, const IntUnivariate<Integer>& b, const Integer& factor = Integer(1)) {
+		IntUnivariate<Integer> res(a);
+		if (res.size() < b.size()) res.resize(b.size(), Integer(0));
+		for (std::size_t i = 0; i < b.size(); i++) res[i] += factor * b[i];
+		strip(res);
+		return res;
+	}
+	/// Reduces all coefficients to [0, m).
+	template<typename Integer>
+	IntUnivariate<Integer> reduce(const IntUnivariate<Integer>& a, const Integer& m) {
+		IntUnivariate<Integer> res(a);
+		for (auto& c: res) {
+			c = carl::mod(c, m);
+			if (carl::isNegative(c)) c += m;
+		}
+		strip(res);
+		return res;
+	}
+	/// Reduces all coefficients to the symmetric range (-m/2, m/2].
+	template<typename Integer>
+	IntUnivariate<Integer> symmetric(const IntUnivariate<Integer>& a, const Integer& m) {
+		IntUnivariate<Integer> res = reduce(a, m);
+		Integer half = carl::quotient(m, Integer(2));
+		for (auto& c: res) {
+			if (c > half) c -= m;
+		}
+		return res;
+	}
+	/// Divides a by the monic polynomial b modulo m, stores the remainder in a and returns the quotient.
+	template<typename Integer>
+	IntUnivariate<Integer> divideMonic(IntUnivariate<Integer>& a, const IntUnivariate<Integer>& b, const Integer& m) {
+		assert(!b.empty() && carl::isOne(b.back()));
+		a = reduce(a, m);
+		if (a.size() < b.size()) return IntUnivariate<Integer>();
+		IntUnivariate<Integer> q(a.size() - b.size() + 1, Integer(0));
+		for (std::size_t i = a.size(); i >= b.size(); i--) {
+			Integer c = a[i-1];
+			if (carl::isZero(c)) continue;
+			std::size_t shift = i - b.size();
+			q[shift] = c;
+			for (std::size_t j = 0; j < b.size(); j++) {
+				a[shift+j] = carl::mod(a[shift+j] - c * b[j], m);
+				if (carl::isNegative(a[shift+j])) a[shift+j] += m;
+			}
+		}
+		strip(a);
+		return q;
+	}
+	/// Exact division over the integers. Returns false if b does not divide a.
+	template<typename Integer>
+	bool divideExact(const IntUnivariate<Integer>& a, const IntUnivariate<Integer>& b, IntUnivariate<Integer>& quotient) {
+		IntUnivariate<Integer> r(a);
+		if (r.size() < b.size()) return false;
+		IntUnivariate<Integer> q(r.size() - b.size() + 1, Integer(0));
+		for (std::size_t i = r.size(); i >= b.size(); i--) {
+			if (carl::isZero(r[i-1])) continue;
+			if (!carl::isZero(carl::mod(r[i-1], b.back()))) return false;
+			Integer c = carl::div(r[i-1], b.back());
+			std::size_t shift = i - b.size();
+			q[shift] = c;
+			for (std::size_t j = 0; j < b.size(); j++) r[shift+j] -= c * b[j];
+		}
+		strip(r);
+		if (!r.empty()) return false;
+		quotient = std::move(q);
+		return true;
+	}
+	template<typename Integer>
+	IntUnivariate<Integer> primitivePart(const IntUnivariate<Integer>& a) {
+		Integer content(0);
+		for (const auto& c: a) content = carl::gcd(content, c);
+		if (carl::isNegative(a.back())) content = -content;
+		IntUnivariate<Integer> res(a);
+		for (auto& c: res) c = carl::div(c, content);
+		return res;
+	}
+	template<typename Integer>
+	ModUnivariate toModular(const IntUnivariate<Integer>& a, std::uint64_t p) {
+		ModUnivariate res;
+		for (const auto& c: reduce(a, Integer(carl::sint(p)))) res.push_back(toInt<carl::uint>(c));
+		modular_gcd::strip(res);
+		return res;
+	}
+	template<typename Integer>
+	IntUnivariate<Integer> fromModular(const ModUnivariate& a) {
+		IntUnivariate<Integer> res;
+		for (const auto& c: a) res.emplace_back(carl::sint(c));
+		return res;
+	}
+	/// Computes the inverse of a modulo m by the extended euclidean algorithm.
+	template<typename Integer>
+	Integer inverse(const Integer& a, const Integer& m) {
+		Integer r0 = carl::mod(a, m), r1 = m;
+		if (carl::isNegative(r0)) r0 += m;
+		Integer s0(1), s1(0);
+		while (!carl::isZero(r1)) {
+			Integer q = carl::div(Integer(r0 - carl::mod(r0, r1)), r1);
+			Integer r2 = r0 - q * r1;
+			Integer s2 = s0 - q * s1;
+			r0 = r1; r1 = r2;
+			s0 = s1; s1 = s2;
+		}
+		assert(carl::isOne(r0));
+		s0 = carl::mod(s0, m);
+		if (carl::isNegative(s0)) s0 += m;
+		return s0;
+	}
+	/// @}
+
+	/**
+	 * Lifts the factorization f = g*h (mod m) with s*g + t*h = 1 (mod m) to a factorization modulo m^2.
+	 * All of f, g and h are monic.
+	 * @see @cite GG99, Algorithm 15.10
+	 */
+	template<typename Integer>
+	void henselStep(const IntUnivariate<Integer>& f, IntUnivariate<Integer>& g, IntUnivariate<Integer>& h, IntUnivariate<Integer>& s, IntUnivariate<Integer>& t, const Integer& m) {
+		Integer M = m * m;
+		IntUnivariate<Integer> e = reduce(add(f, multiply(g, h), Integer(-1)), M);
+		IntUnivariate<Integer> r = reduce(multiply(s, e), M);
+		IntUnivariate<Integer> q = divideMonic(r, h, M);
+		IntUnivariate<Integer> gnew = reduce(add(add(g, multiply(t, e)), multiply(q, g)), M);
+		IntUnivariate<Integer> hnew = reduce(add(h, r), M);
+		IntUnivariate<Integer> b = reduce(add(add(multiply(s, gnew), multiply(t, hnew)), IntUnivariate<Integer>({Integer(1)}), Integer(-1)), M);
+		IntUnivariate<Integer> d = reduce(multiply(s, b), M);
+		IntUnivariate<Integer> c = divideMonic(d, hnew, M);
+		s = reduce(add(s, d, Integer(-1)), M);
+		t = reduce(add(add(t, multiply(t, b), Integer(-1)), multiply(c, gnew), Integer(-1)), M);
+		g = std::move(gnew);
+		h = std::move(hnew);
+	}
+
+	/**
+	 * Lifts the monic modular factorization of the monic polynomial f (mod p) to a factorization modulo m = p^(2^k) >= bound.
+	 */
+	template<typename Integer>
+	std::vector<IntUnivariate<Integer>> henselLifting(const IntUnivariate<Integer>& f, const std::vector<ModUnivariate>& factors, std::uint64_t p, const Integer& modulus) {
+		if (factors.size() == 1) return { reduce(f, modulus) };
+		std::size_t split = factors.size() / 2;
+		std::vector<ModUnivariate> first(factors.begin(), factors.begin() + long(split));
+		std::vector<ModUnivariate> second(factors.begin() + long(split), factors.end());
+		ModUnivariate g0({1}), h0({1});
+		for (const auto& u: first) g0 = modular_gcd::multiply(g0, u, p);
+		for (const auto& u: second) h0 = modular_gcd::multiply(h0, u, p);
+		ModUnivariate s0, t0;
+		extendedGCD(g0, h0, p, s0, t0);
+		IntUnivariate<Integer> g = fromModular<Integer>(g0);
+		IntUnivariate<Integer> h = fromModular<Integer>(h0);
+		IntUnivariate<Integer> s = fromModular<Integer>(s0);
+		IntUnivariate<Integer> t = fromModular<Integer>(t0);
+		for (Integer m = Integer(carl::sint(p)); m < modulus; m *= m) {
+			henselStep(f, g, h, s, t, m);
+		}
+		auto res = henselLifting(g, first, p, modulus);
+		auto res2 = henselLifting(h, second, p, modulus);
+		res.insert(res.end(), res2.begin(), res2.end());
+		return res;
+	}
+
+	/**
+	 * Computes the irreducible factors of a primitive, square-free polynomial over the integers.
+	 * @param f Polynomial given by its coefficients, the leading coefficient being positive.
+	 * @return Primitive irreducible factors with positive leading coefficients.
+	 */
+	template<typename Integer>
+	std::vector<IntUnivariate<Integer>> factor(const IntUnivariate<Integer>& f) {
+		assert(f.size() >= 2);
+		if (f.size() == 2) return { f };
+		IntUnivariate<Integer> derivative;
+		for (std::size_t i = 1; i < f.size(); i++) derivative.push_back(f[i] * Integer(carl::sint(i)));
+
+		// Select a prime for which f stays square-free, preferring few modular factors.
+		std::uint64_t prime = 0;
+		std::vector<ModUnivariate> modFactors;
+		std::uint64_t candidate = (std::uint64_t(1) << 15);
+		for (std::size_t tries = 0; tries < 3; ) {
+			candidate = modular_gcd::previousPrime(candidate);
+			assert(candidate > 2);
+			Integer ip = Integer(carl::sint(candidate));
+			if (carl::isZero(carl::mod(f.back(), ip))) continue;
+			ModUnivariate fp = toModular(f, candidate);
+			if (modular_gcd::gcd(fp, toModular(derivative, candidate), candidate).size() != 1) continue;
+			auto factors = factorModP<Integer>(modular_gcd::monic(fp, candidate), candidate);
+			if (prime == 0 || factors.size() < modFactors.size()) {
+				prime = candidate;
+				modFactors = std::move(factors);
+			}
+			tries++;
+			if (modFactors.size() == 1) break;
+		}
+		CARL_LOG_DEBUG("carl.core.factorize", "Using prime " << prime << " with " << modFactors.size() << " modular factors");
+		if (modFactors.size() == 1) return { f };
+
+		// Bound the coefficients of lc(f) times any factor of f by |lc(f)| * 2^deg(f) * ||f||_1.
+		Integer norm(0);
+		for (const auto& c: f) norm += carl::abs(c);
+		Integer bound = Integer(2) * carl::abs(f.back()) * carl::pow(Integer(2), f.size() - 1) * norm;
+		Integer modulus = Integer(carl::sint(prime));
+		while (modulus <= bound) modulus *= modulus;
+
+		IntUnivariate<Integer> monicF(f);
+		Integer lcInv = inverse(f.back(), modulus);
+		for (auto& c: monicF) c *= lcInv;
+		monicF = reduce(monicF, modulus);
+		std::vector<IntUnivariate<Integer>> lifted = henselLifting(monicF, modFactors, prime, modulus);
+
+		// Recombination: try subsets of increasing size.
+		std::vector<IntUnivariate<Integer>> res;
+		IntUnivariate<Integer> rest(f);
+		std::size_t size = 1;
+		while (2 * size <= lifted.size()) {
+			bool found = false;
+			std::vector<std::size_t> subset(size);
+			for (std::size_t i = 0; i < size; i++) subset[i] = i;
+			while (true) {
+				IntUnivariate<Integer> g({rest.back()});
+				for (auto i: subset) g = reduce(multiply(g, lifted[i]), modulus);
+				g = primitivePart(symmetric(g, modulus));
+				IntUnivariate<Integer> quotient;
+				if (divideExact(rest, g, quotient)) {
+					res.push_back(g);
+					rest = std::move(quotient);
+					for (auto it = subset.rbegin(); it != subset.rend(); ++it) {
+						lifted.erase(lifted.begin() + long(*it));
+					}
+					found = true;
+					break;
+				}
+				// Advance to the next subset in lexicographic order.
+				std::size_t i = size;
+				while (i > 0 && subset[i-1] == lifted.size() - size + i - 1) i--;
+				if (i == 0) break;
+				subset[i-1]++;
+				for (std::size_t j = i; j < size; j++) subset[j] = subset[j-1] + 1;
+			}
+			if (!found) size++;
+		}
+		if (rest.size() > 1) res.push_back(primitivePart(rest));
+		return res;
+	}
+}
+}
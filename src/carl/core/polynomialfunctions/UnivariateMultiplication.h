@@ -0,0 +1,370 @@
+/**
+ * @file   UnivariateMultiplication.h
+ * @ingroup unirp
+ *
+ * Size-adaptive multiplication and division of dense coefficient vectors as used by UnivariatePolynomial.
+ * Small operands are multiplied by the schoolbook method, larger ones by Karatsuba's method (@cite GG13, Algorithm 8.1)
+ * and integral or rational operands of large degree by number theoretic transforms modulo several word-sized primes,
+ * followed by chinese remaindering (@cite GG13, Sections 8.2 and 8.3).
+ * Division over fields uses Newton iteration to invert the reversed divisor (@cite GG13, Algorithm 9.5).
+ */
+
+#pragma once
+
+#include "../ModularArithmetic.h"
+#include "../../numbers/numbers.h"
+#include "../../util/SFINAE.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace carl
+{
+template<typename C, typename O, typename P>
+class MultivariatePolynomial;
+
+namespace univariate_multiplication
+{
+	/// Operands with fewer coefficients are multiplied by the schoolbook method.
+	constexpr std::size_t karatsuba_threshold = 24;
+	/// Integral or rational operands with at least this many coefficients are multiplied by number theoretic transforms.
+	constexpr std::size_t ntt_threshold = 48;
+	/// Division uses Newton iteration if both the divisor and the quotient have at least this many coefficients.
+	constexpr std::size_t newton_threshold = 64;
+
+	/// Karatsuba's method is only used for exact coefficients, as it is not suited for floats or intervals.
+	template<typename Coeff>
+	struct use_karatsuba: std::integral_constant<bool,
+		is_subset_of_rationals<Coeff>::value || is_subset_of_integers<Coeff>::value || is_instantiation_of<MultivariatePolynomial, Coeff>::value
+	> {};
+	template<typename Coeff>
+	struct use_ntt: std::integral_constant<bool, is_rational<Coeff>::value || is_integer<Coeff>::value> {};
+
+	/// Adds a * b to res, where res has at least na + nb - 1 entries.
+	template<typename Coeff>
+	void schoolbook(const Coeff* a, std::size_t na, const Coeff* b, std::size_t nb, Coeff* res) {
+		for (std::size_t i = 0; i < na; i++) {
+			for (std::size_t j = 0; j < nb; j++) {
+				res[i+j] += a[i] * b[j];
+			}
+		}
+	}
+
+	/// Adds a * b to res, where res has at least na + nb - 1 entries.
+	template<typename Coeff>
+	void karatsuba(const Coeff* a, std::size_t na, const Coeff* b, std::size_t nb, Coeff* res) {
+		if (na < nb) return karatsuba(b, nb, a, na, res);
+		if (nb < karatsuba_threshold) return schoolbook(a, na, b, nb, res);
+		if (na > nb) {
+			// Multiply chunks of a of the size of b.
+			for (std::size_t i = 0; i < na; i += nb) {
+				karatsuba(a + i, std::min(nb, na - i), b, nb, res + i);
+			}
+			return;
+		}
+		// a = a0 + x^h a1, b = b0 + x^h b1 with n - h >= h.
+		std::size_t n = na;
+		std::size_t h = n / 2;
+		std::size_t l = n - h;
+		std::vector<Coeff> z0(2*h - 1, Coeff(0));
+		std::vector<Coeff> z2(2*l - 1, Coeff(0));
+		std::vector<Coeff> z1(2*l - 1, Coeff(0));
+		karatsuba(a, h, b, h, z0.data());
+		karatsuba(a + h, l, b + h, l, z2.data());
+		std::vector<Coeff> sa(a + h, a + n);
+		std::vector<Coeff> sb(b + h, b + n);
+		for (std::size_t i = 0; i < h; i++) {
+			sa[i] += a[i];
+			sb[i] += b[i];
+		}
+		karatsuba(sa.data(), l, sb.data(), l, z1.data());
+		for (std::size_t i = 0; i < z0.size(); i++) {
+			res[i] += z0[i];
+			z1[i] -= z0[i];
+		}
+		for (std::size_t i = 0; i < z2.size(); i++) {
+			res[2*h + i] += z2[i];
+			z1[i] -= z2[i];
+		}
+		for (std::size_t i = 0; i < z1.size(); i++) {
+			res[h + i] += z1[i];
+		}
+	}
+
+	/// Prime \f$p = c 2^k + 1\f$ together with a primitive \f$2^k\f$-th root of unity.
+	struct NTTPrime {
+		std::uint64_t prime;
+		std::uint64_t root;
+	};
+	/// Transforms have a length of at most \f$2^{ntt_log_length}\f$.
+	constexpr std::size_t ntt_log_length = 20;
+
+	/// Deterministic Miller-Rabin test for numbers below \f$2^{32}\f$.
+	inline bool isPrime(std::uint64_t n) {
+		if (n < 2) return false;
+		for (std::uint64_t q: {2, 3, 5, 7}) {
+			if (n % q == 0) return n == q;
+		}
+		std::uint64_t d = n - 1;
+		std::size_t s = 0;
+		while (d % 2 == 0) {
+			d /= 2;
+			s++;
+		}
+		for (std::uint64_t a: {2, 7, 61}) {
+			if (a % n == 0) continue;
+			std::uint64_t x = modular_gcd::powmod(a, d, n);
+			if (x == 1 || x == n - 1) continue;
+			bool composite = true;
+			for (std::size_t r = 1; r < s && composite; r++) {
+				x = modular_gcd::mulmod(x, x, n);
+				if (x == n - 1) composite = false;
+			}
+			if (composite) return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Returns all primes below \f$2^{31}\f$ that allow for transforms of length \f$2^{ntt_log_length}\f$, starting with the largest one.
+	 * The list is computed once.
+	 */
+	inline const std::vector<NTTPrime>& nttPrimes() {
+		static const std::vector<NTTPrime> primes = [](){
+			std::vector<NTTPrime> res;
+			const std::uint64_t step = std::uint64_t(1) << ntt_log_length;
+			for (std::uint64_t c = (modular_gcd::max_prime - 1) / step; c > 0; c--) {
+				std::uint64_t p = c * step + 1;
+				if (!isPrime(p)) continue;
+				// Find a generator of the multiplicative group, p - 1 = c * 2^k.
+				std::vector<std::uint64_t> factors({2});
+				std::uint64_t rest = c;
+				for (std::uint64_t q = 2; q * q <= rest; q++) {
+					if (rest % q != 0) continue;
+					factors.push_back(q);
+					while (rest % q == 0) rest /= q;
+				}
+				if (rest > 1) factors.push_back(rest);
+				for (std::uint64_t g = 2; g < p; g++) {
+					bool generator = std::all_of(factors.begin(), factors.end(), [&](std::uint64_t q){ return modular_gcd::powmod(g, (p - 1) / q, p) != 1; });
+					if (generator) {
+						res.push_back(NTTPrime({p, modular_gcd::powmod(g, c, p)}));
+						break;
+					}
+				}
+			}
+			return res;
+		}();
+		return primes;
+	}
+
+	/// In-place number theoretic transform of a vector whose length is a power of two.
+	inline void ntt(std::vector<std::uint64_t>& a, bool inverse, const NTTPrime& np) {
+		std::size_t n = a.size();
+		std::uint64_t p = np.prime;
+		for (std::size_t i = 1, j = 0; i < n; i++) {
+			std::size_t bit = n >> 1;
+			for (; j & bit; bit >>= 1) j ^= bit;
+			j ^= bit;
+			if (i < j) std::swap(a[i], a[j]);
+		}
+		for (std::size_t len = 2, level = 1; len <= n; len <<= 1, level++) {
+			std::uint64_t w = modular_gcd::powmod(np.root, std::uint64_t(1) << (ntt_log_length - level), p);
+			if (inverse) w = modular_gcd::invmod(w, p);
+			std::vector<std::uint64_t> powers(len / 2);
+			powers[0] = 1;
+			for (std::size_t k = 1; k < len / 2; k++) powers[k] = modular_gcd::mulmod(powers[k-1], w, p);
+			for (std::size_t i = 0; i < n; i += len) {
+				for (std::size_t k = 0; k < len / 2; k++) {
+					std::uint64_t u = a[i+k];
+					std::uint64_t v = modular_gcd::mulmod(a[i+k+len/2], powers[k], p);
+					a[i+k] = modular_gcd::addmod(u, v, p);
+					a[i+k+len/2] = modular_gcd::submod(u, v, p);
+				}
+			}
+		}
+		if (inverse) {
+			std::uint64_t ninv = modular_gcd::invmod(n % p, p);
+			for (auto& c: a) c = modular_gcd::mulmod(c, ninv, p);
+		}
+	}
+
+	/**
+	 * Multiplies two integral vectors by number theoretic transforms modulo sufficiently many primes and chinese remaindering.
+	 * @return false if the transform would be too long or if there are not enough primes for the size of the coefficients.
+	 */
+	template<typename Integer>
+	bool multimodular(const std::vector<Integer>& a, const std::vector<Integer>& b, std::vector<Integer>& res) {
+		std::size_t length = 1;
+		while (length < a.size() + b.size() - 1) length <<= 1;
+		if (length > (std::size_t(1) << ntt_log_length)) return false;
+		Integer maxA = 0;
+		Integer maxB = 0;
+		for (const auto& c: a) maxA = std::max(maxA, Integer(carl::abs(c)));
+		for (const auto& c: b) maxB = std::max(maxB, Integer(carl::abs(c)));
+		Integer bound = Integer(2) * Integer(carl::sint(std::min(a.size(), b.size()))) * maxA * maxB;
+
+		const auto& primes = nttPrimes();
+		std::vector<std::vector<std::uint64_t>> images;
+		Integer modulus = 1;
+		for (const auto& np: primes) {
+			if (modulus > bound) break;
+			Integer ip = Integer(carl::sint(np.prime));
+			auto reduce = [&](const std::vector<Integer>& v){
+				std::vector<std::uint64_t> r(length, 0);
+				for (std::size_t i = 0; i < v.size(); i++) {
+					Integer c = carl::mod(v[i], ip);
+					if (carl::isNegative(c)) c += ip;
+					r[i] = toInt<carl::uint>(c);
+				}
+				return r;
+			};
+			std::vector<std::uint64_t> fa = reduce(a);
+			std::vector<std::uint64_t> fb = reduce(b);
+			ntt(fa, false, np);
+			ntt(fb, false, np);
+			for (std::size_t i = 0; i < length; i++) fa[i] = modular_gcd::mulmod(fa[i], fb[i], np.prime);
+			ntt(fa, true, np);
+			fa.resize(a.size() + b.size() - 1);
+			images.push_back(std::move(fa));
+			modulus *= ip;
+		}
+		if (modulus <= bound) return false;
+
+		// Chinese remaindering by Garner's algorithm.
+		res.assign(a.size() + b.size() - 1, Integer(0));
+		Integer partial = 1;
+		for (std::size_t k = 0; k < images.size(); k++) {
+			std::uint64_t p = primes[k].prime;
+			Integer ip = Integer(carl::sint(p));
+			std::uint64_t inv = (k == 0) ? 1 : modular_gcd::invmod(toInt<carl::uint>(Integer(carl::mod(partial, ip))), p);
+			for (std::size_t i = 0; i < res.size(); i++) {
+				Integer cur = carl::mod(res[i], ip);
+				if (carl::isNegative(cur)) cur += ip;
+				std::uint64_t delta = modular_gcd::submod(images[k][i], toInt<carl::uint>(cur), p);
+				if (delta != 0) res[i] += partial * Integer(carl::sint(modular_gcd::mulmod(delta, inv, p)));
+			}
+			partial *= ip;
+		}
+		Integer half = carl::quotient(modulus, Integer(2));
+		for (auto& c: res) {
+			if (c > half) c -= modulus;
+		}
+		return true;
+	}
+
+	template<typename Coeff, EnableIf<is_integer<Coeff>> = dummy>
+	bool multimodularMultiply(const std::vector<Coeff>& a, const std::vector<Coeff>& b, std::vector<Coeff>& res) {
+		return multimodular(a, b, res);
+	}
+	template<typename Coeff, EnableIf<is_rational<Coeff>> = dummy>
+	bool multimodularMultiply(const std::vector<Coeff>& a, const std::vector<Coeff>& b, std::vector<Coeff>& res) {
+		using Integer = typename IntegralType<Coeff>::type;
+		auto toIntegral = [](const std::vector<Coeff>& v, Integer& den){
+			den = 1;
+			for (const auto& c: v) den = carl::lcm(den, getDenom(c));
+			std::vector<Integer> r;
+			r.reserve(v.size());
+			for (const auto& c: v) r.push_back(getNum(Coeff(c * den)));
+			return r;
+		};
+		Integer denA;
+		Integer denB;
+		std::vector<Integer> ia = toIntegral(a, denA);
+		std::vector<Integer> ib = toIntegral(b, denB);
+		std::vector<Integer> ir;
+		if (!multimodular(ia, ib, ir)) return false;
+		Coeff den = Coeff(denA * denB);
+		res.clear();
+		res.reserve(ir.size());
+		for (const auto& c: ir) res.push_back(Coeff(c) / den);
+		return true;
+	}
+	template<typename Coeff, DisableIf<use_ntt<Coeff>> = dummy>
+	bool multimodularMultiply(const std::vector<Coeff>&, const std::vector<Coeff>&, std::vector<Coeff>&) {
+		return false;
+	}
+
+	template<typename Coeff, EnableIf<use_karatsuba<Coeff>> = dummy>
+	void denseMultiply(const std::vector<Coeff>& a, const std::vector<Coeff>& b, std::vector<Coeff>& res) {
+		karatsuba(a.data(), a.size(), b.data(), b.size(), res.data());
+	}
+	template<typename Coeff, DisableIf<use_karatsuba<Coeff>> = dummy>
+	void denseMultiply(const std::vector<Coeff>& a, const std::vector<Coeff>& b, std::vector<Coeff>& res) {
+		schoolbook(a.data(), a.size(), b.data(), b.size(), res.data());
+	}
+
+	/**
+	 * Multiplies two nonempty coefficient vectors, choosing the method by the number of coefficients.
+	 * The result may have trailing zeros.
+	 */
+	template<typename Coeff>
+	std::vector<Coeff> multiply(const std::vector<Coeff>& a, const std::vector<Coeff>& b) {
+		assert(!a.empty() && !b.empty());
+		std::vector<Coeff> res;
+		if (std::min(a.size(), b.size()) >= ntt_threshold && multimodularMultiply(a, b, res)) {
+			return res;
+		}
+		res.assign(a.size() + b.size() - 1, Coeff(0));
+		denseMultiply(a, b, res);
+		return res;
+	}
+
+	/// Computes g such that f * g = 1 modulo \f$x^n\f$, assuming that the constant coefficient of f is invertible.
+	template<typename Coeff>
+	std::vector<Coeff> inverseSeries(const std::vector<Coeff>& f, std::size_t n) {
+		assert(!f.empty() && !carl::isZero(f.front()));
+		std::vector<Coeff> g({Coeff(1) / f.front()});
+		for (std::size_t k = 1; k < n; ) {
+			k = std::min(2*k, n);
+			// g = g * (2 - f * g) mod x^k
+			std::vector<Coeff> e = multiply(std::vector<Coeff>(f.begin(), f.begin() + long(std::min(k, f.size()))), g);
+			e.resize(k, Coeff(0));
+			for (auto& c: e) c = -c;
+			e[0] += Coeff(2);
+			g = multiply(g, e);
+			g.resize(k, Coeff(0));
+		}
+		return g;
+	}
+
+	/**
+	 * Divides a by b over a field by Newton iteration, where the degree of a is at least the degree of b.
+	 * @param a Dividend without leading zeros.
+	 * @param b Divisor without leading zeros.
+	 * @param quotient Resulting quotient.
+	 * @param remainder Resulting remainder, without leading zeros.
+	 */
+	template<typename Coeff>
+	void divide(const std::vector<Coeff>& a, const std::vector<Coeff>& b, std::vector<Coeff>& quotient, std::vector<Coeff>& remainder) {
+		assert(a.size() >= b.size() && !b.empty());
+		std::size_t k = a.size() - b.size() + 1;
+		std::vector<Coeff> ra(a.rbegin(), a.rbegin() + long(k));
+		std::vector<Coeff> rb(b.rbegin(), b.rbegin() + long(std::min(k, b.size())));
+		quotient = multiply(ra, inverseSeries(rb, k));
+		quotient.resize(k, Coeff(0));
+		std::reverse(quotient.begin(), quotient.end());
+		std::vector<Coeff> product = multiply(b, quotient);
+		remainder.assign(a.begin(), a.begin() + long(b.size() - 1));
+		for (std::size_t i = 0; i < remainder.size(); i++) remainder[i] -= product[i];
+		while (!remainder.empty() && carl::isZero(remainder.back())) remainder.pop_back();
+	}
+
+	/**
+	 * Divides a by b by Newton iteration if the coefficients are rational and both the divisor and the quotient are large.
+	 * @return false if the schoolbook division should be used instead.
+	 */
+	template<typename Coeff, EnableIf<is_rational<Coeff>> = dummy>
+	bool fastDivide(const std::vector<Coeff>& a, const std::vector<Coeff>& b, std::vector<Coeff>& quotient, std::vector<Coeff>& remainder) {
+		if (a.size() < b.size() || b.size() < newton_threshold || a.size() - b.size() + 1 < newton_threshold) return false;
+		divide(a, b, quotient, remainder);
+		return true;
+	}
+	template<typename Coeff, DisableIf<is_rational<Coeff>> = dummy>
+	bool fastDivide(const std::vector<Coeff>&, const std::vector<Coeff>&, std::vector<Coeff>&, std::vector<Coeff>&) {
+		return false;
+	}
+}
+}
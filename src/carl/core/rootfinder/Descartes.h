@@ -0,0 +1,195 @@
+/**
+ * @file Descartes.h
+ * @ingroup rootfinder
+ *
+ * Real root isolation by Descartes' rule of signs and bisection (Vincent-Collins-Akritas, @cite CA76).
+ * The polynomial is mapped to the unit interval once and the bisection then works on integer coefficient vectors only:
+ * the left half is obtained by scaling, the right half by an additional Taylor shift by one.
+ */
+
+#pragma once
+
+#include "../Sign.h"
+#include "../../numbers/numbers.h"
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace carl {
+namespace rootfinder {
+namespace descartes {
+
+	/**
+	 * Replaces a by \f$a(x + s)\f$ using \f$O(n^2)\f$ additions and multiplications by s.
+	 * For the shifts by one that dominate the bisection, only additions are needed.
+	 * This is faster than the asymptotically fast shift by divide and conquer for all practical degrees.
+	 */
+	template<typename Integer>
+	void taylorShift(std::vector<Integer>& a, const Integer& s) {
+		if (a.size() < 2) return;
+		bool one = carl::isOne(s);
+		for (std::size_t i = 0; i + 1 < a.size(); i++) {
+			for (std::size_t j = a.size() - 1; j-- > i; ) {
+				if (one) a[j] += a[j+1];
+				else a[j] += s * a[j+1];
+			}
+		}
+	}
+
+	/// Number of sign variations in a, ignoring zeros.
+	template<typename Integer>
+	std::size_t signVariations(const std::vector<Integer>& a) {
+		std::size_t res = 0;
+		Sign last = Sign::ZERO;
+		for (const auto& c: a) {
+			Sign s = carl::sgn(c);
+			if (s == Sign::ZERO) continue;
+			if (last != Sign::ZERO && s != last) res++;
+			last = s;
+		}
+		return res;
+	}
+
+	/**
+	 * Descartes' bound for the number of roots of a in \f$(0,1)\f$, obtained from the sign variations of \f$(x+1)^n a(1/(x+1))\f$.
+	 * The bound is exact if it is zero or one.
+	 */
+	template<typename Integer>
+	std::size_t unitIntervalBound(const std::vector<Integer>& a) {
+		std::vector<Integer> r(a.rbegin(), a.rend());
+		taylorShift(r, Integer(1));
+		return signVariations(r);
+	}
+
+	/// Replaces a by \f$2^n a(x/2)\f$.
+	template<typename Integer>
+	void halve(std::vector<Integer>& a) {
+		Integer factor = 1;
+		for (std::size_t i = a.size(); i-- > 0; ) {
+			a[i] *= factor;
+			factor *= 2;
+		}
+	}
+
+	/// Divides a by the gcd of its coefficients.
+	template<typename Integer>
+	void makePrimitive(std::vector<Integer>& a) {
+		Integer g = 0;
+		for (const auto& c: a) {
+			g = carl::gcd(g, c);
+			if (carl::isOne(g)) return;
+		}
+		if (carl::isZero(g)) return;
+		for (auto& c: a) c = carl::div(c, g);
+	}
+
+	/// Dyadic subinterval \f$(c/2^k, (c+1)/2^k)\f$ of the unit interval, or the point \f$c/2^k\f$.
+	template<typename Integer>
+	struct Dyadic {
+		Integer c;
+		std::size_t k;
+	};
+
+	/**
+	 * Result of the isolation in the unit interval.
+	 */
+	template<typename Integer>
+	struct UnitIsolation {
+		/// Open intervals that contain exactly one root each.
+		std::vector<Dyadic<Integer>> intervals;
+		/// Roots that were hit exactly by bisection.
+		std::vector<Dyadic<Integer>> roots;
+	};
+
+	/**
+	 * Isolates the real roots of the square-free polynomial a within \f$(0,1)\f$.
+	 * The endpoints of the intervals may be exact roots, but these are reported as well.
+	 * @param a Integer coefficients, neither 0 nor 1 is a root.
+	 */
+	template<typename Integer>
+	UnitIsolation<Integer> isolateUnitInterval(const std::vector<Integer>& a) {
+		struct Node {
+			std::vector<Integer> poly;
+			Dyadic<Integer> interval;
+		};
+		UnitIsolation<Integer> res;
+		std::vector<Node> stack({ Node{a, Dyadic<Integer>{Integer(0), 0}} });
+		while (!stack.empty()) {
+			Node node = std::move(stack.back());
+			stack.pop_back();
+			std::size_t bound = unitIntervalBound(node.poly);
+			if (bound == 0) continue;
+			if (bound == 1) {
+				res.intervals.push_back(node.interval);
+				continue;
+			}
+			std::vector<Integer> left = std::move(node.poly);
+			halve(left);
+			makePrimitive(left);
+			std::vector<Integer> right = left;
+			taylorShift(right, Integer(1));
+			Dyadic<Integer> leftInterval{node.interval.c * 2, node.interval.k + 1};
+			Dyadic<Integer> rightInterval{node.interval.c * 2 + 1, node.interval.k + 1};
+			if (carl::isZero(right.front())) {
+				// The midpoint is a root.
+				res.roots.push_back(rightInterval);
+				right.erase(right.begin());
+			}
+			stack.push_back(Node{std::move(right), rightInterval});
+			stack.push_back(Node{std::move(left), leftInterval});
+		}
+		return res;
+	}
+
+	/**
+	 * Computes integer coefficients of \f$p(l + (u-l) x)\f$ for a polynomial with rational coefficients.
+	 * Uses \f$p(l + w x) = R(A + W x)\f$ with \f$l = A/D\f$, \f$w = W/D\f$ and \f$R(y) = D^n p(y / D)\f$, where R has integral coefficients.
+	 */
+	template<typename Number, typename Integer = typename IntegralType<Number>::type>
+	std::vector<Integer> toUnitInterval(const std::vector<Number>& p, const Number& lower, const Number& upper) {
+		Number width = upper - lower;
+		Integer denominator = carl::lcm(getDenom(lower), getDenom(width));
+		Integer A = getNum(lower * Number(denominator));
+		Integer W = getNum(width * Number(denominator));
+		Integer pdenominator = 1;
+		for (const auto& c: p) pdenominator = carl::lcm(pdenominator, getDenom(c));
+		std::vector<Integer> r(p.size());
+		Integer power = 1;
+		for (std::size_t i = p.size(); i-- > 0; ) {
+			r[i] = getNum(p[i] * Number(pdenominator)) * power;
+			power *= denominator;
+		}
+		taylorShift(r, A);
+		power = 1;
+		for (auto& c: r) {
+			c *= power;
+			power *= W;
+		}
+		makePrimitive(r);
+		return r;
+	}
+
+	/**
+	 * Isolates the real roots of a square-free polynomial with rational coefficients within the open interval \f$(l,u)\f$.
+	 * @param p Coefficients of the polynomial, neither l nor u is a root.
+	 * @param intervals Pairs of bounds of open isolating intervals.
+	 * @param roots Roots that were found exactly.
+	 */
+	template<typename Number>
+	void isolate(const std::vector<Number>& p, const Number& lower, const Number& upper, std::vector<std::pair<Number, Number>>& intervals, std::vector<Number>& roots) {
+		using Integer = typename IntegralType<Number>::type;
+		assert(lower < upper);
+		UnitIsolation<Integer> iso = isolateUnitInterval(toUnitInterval(p, lower, upper));
+		Number width = upper - lower;
+		auto point = [&lower,&width](const Integer& c, std::size_t k) -> Number {
+			Integer denominator = 1;
+			for (std::size_t i = 0; i < k; i++) denominator *= 2;
+			return lower + width * Number(c) / Number(denominator);
+		};
+		for (const auto& r: iso.roots) roots.push_back(point(r.c, r.k));
+		for (const auto& i: iso.intervals) intervals.emplace_back(point(i.c, i.k), point(i.c + 1, i.k));
+	}
+}
+}
+}
@@ -10,6 +10,11 @@
 
 #include <queue>
 
+#ifdef THREAD_SAFE
+#include <condition_variable>
+#include <mutex>
+#endif
+
 namespace carl {
 namespace rootfinder {
 
@@ -52,6 +57,8 @@ enum class SplittingStrategy {
 	EIGENVALUES,
 	/// Uses AberthStrategy for first step, BinarySampleStrategy afterwards
 	ABERTH,
+	/// Uses DescartesStrategy
+	DESCARTES,
 	/// Defaults to EIGENVALUES
 	DEFAULT = EIGENVALUES
 };
@@ -70,6 +77,7 @@ inline std::ostream& operator<<(std::ostream& os, const SplittingStrategy& s) {
 		case SplittingStrategy::GRID: return os << "Grid";
 		case SplittingStrategy::EIGENVALUES: return os << "Eigenvalues";
 		case SplittingStrategy::ABERTH: return os << "Aberth";
+		case SplittingStrategy::DESCARTES: return os << "Descartes";
 	}
 }
 
@@ -196,6 +204,20 @@ struct AberthStrategy : AbstractStrategy<AberthStrategy<Number>, Number> {
 	virtual void operator()(const Interval<Number>& interval, RootFinder<Number>& finder);
 };
 
+/**
+ * Implements a complete isolation based on Descartes' rule of signs.
+ */
+template<typename Number>
+struct DescartesStrategy : AbstractStrategy<DescartesStrategy<Number>, Number> {
+	/**
+	 * Given an interval \f$(a,b)\f$, isolates all real roots within \f$(a,b)\f$ by Descartes' rule of signs and bisection on integer coefficients.
+	 * Works on rational numbers only, other number types as well as intervals whose bounds are roots are passed on to BinarySampleStrategy.
+	 * @param interval Interval.
+	 * @param finder Finder object.
+	 */
+	virtual void operator()(const Interval<Number>& interval, RootFinder<Number>& finder);
+};
+
 }
 
 /**
@@ -203,6 +225,11 @@ struct AberthStrategy : AbstractStrategy<AberthStrategy<Number>, Number> {
  *
  * Using the method next(), the next real root can be obtained.
  * The root finder uses a bisection approach internally and implements multiple strategies how the bisection is performed.
+ *
+ * If carl is built with THREAD_SAFE and more than one thread is requested, the queue is processed by several threads.
+ * The intervals in the queue are disjoint, hence every thread takes an interval, splits it and puts the parts back into the queue independently of the others.
+ * In this mode, exact roots are not eliminated from the polynomial, such that all threads work on the same polynomial.
+ * The roots are sorted when the search has finished, hence the result does not depend on the timing of the threads.
  */
 template<typename Number, typename Comparator>
 class IncrementalRootFinder: public AbstractRootFinder<Number>, public RootFinder<Number> {
@@ -227,6 +254,24 @@ private:
 	 * Interval queue containing all items that must still be processed.
 	 */
 	std::priority_queue<QueueItem, std::vector<QueueItem>, IntervalSizeComparator> queue;
+	/**
+	 * Number of threads processing the queue (only used if carl is built with THREAD_SAFE).
+	 */
+	std::size_t threads;
+#ifdef THREAD_SAFE
+	/**
+	 * Flag if the queue is currently processed by several threads.
+	 */
+	bool parallel = false;
+	/**
+	 * Synchronizes the access to the queue and the roots while the queue is processed by several threads.
+	 */
+	std::mutex mutex;
+	/**
+	 * Notifies idle threads about new queue items or the end of the search.
+	 */
+	std::condition_variable queueChanged;
+#endif
 public:
 
 	/**
@@ -235,12 +280,14 @@ public:
 	 * @param interval Interval, unbounded if none is given.
 	 * @param splittingStrategy Strategy.
 	 * @param tryTrivialSolver Flag is the trivial solver shall be used.
+	 * @param threads Number of threads processing the queue.
 	 */
 	explicit IncrementalRootFinder(
 			const UnivariatePolynomial<Number>& polynomial,
 			const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
 			SplittingStrategy strategy = SplittingStrategy::DEFAULT,
-			bool tryTrivialSolver = true
+			bool tryTrivialSolver = true,
+			std::size_t threads = 1
 			);
 
 	/**
@@ -259,15 +306,39 @@ public:
 	 * @param strategy Strategy to add.
 	 */
 	void addQueue(const Interval<Number>& interval, SplittingStrategy strategy) {
-	   this->queue.push(std::make_tuple(interval, strategy));
+#ifdef THREAD_SAFE
+		if (parallel) {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				this->queue.push(std::make_tuple(interval, strategy));
+			}
+			queueChanged.notify_one();
+			return;
+		}
+#endif
+		this->queue.push(std::make_tuple(interval, strategy));
 	}
 
 protected:
 
 	virtual void addRoot(const RealAlgebraicNumber<Number>& root, bool reducePolynomial = true) {
+#ifdef THREAD_SAFE
+		if (parallel) {
+			std::lock_guard<std::mutex> lock(mutex);
+			AbstractRootFinder<Number>::addRoot(root, false);
+			return;
+		}
+#endif
 		AbstractRootFinder<Number>::addRoot(root, reducePolynomial);
 	}
 	virtual void addRoot(const Interval<Number>& interval) {
+#ifdef THREAD_SAFE
+		if (parallel) {
+			// Construct the number outside of the lock, the polynomial is not changed in parallel mode.
+			this->addRoot(RealAlgebraicNumber<Number>(getPolynomial(), interval));
+			return;
+		}
+#endif
 		AbstractRootFinder<Number>::addRoot(interval);
 	}
 
@@ -283,6 +354,19 @@ protected:
 	 * @return False, if the queue is empty, i.e. we have found all roots.
 	 */
 	bool processQueueItem();
+
+	/**
+	 * Processes a single item that was taken from the queue.
+	 * @param item Queue item.
+	 */
+	void process(const QueueItem& item);
+
+#ifdef THREAD_SAFE
+	/**
+	 * Processes the queue with the given number of threads until it is empty and no thread is working on an item.
+	 */
+	void processQueueInParallel();
+#endif
 };
 
 }
@@ -8,11 +8,17 @@
 
 #include "../../util/debug.h"
 #include "../logging.h"
+#include "../polynomialfunctions/RootBounds.h"
 #include "AbstractRootFinder.h"
 #include "RootFinder.h"
 
+#include "Descartes.h"
 #include "EigenWrapper.h"
 
+#ifdef THREAD_SAFE
+#include <thread>
+#endif
+
 namespace carl {
 namespace rootfinder {
 
@@ -21,10 +27,12 @@ IncrementalRootFinder<Number, C>::IncrementalRootFinder(
 		const UnivariatePolynomial<Number>& polynomial,
 		const Interval<Number>& interval,
 		SplittingStrategy strategy,
-		bool tryTrivialSolver
+		bool tryTrivialSolver,
+		std::size_t threads
 		) :
 		AbstractRootFinder<Number>(polynomial, interval, tryTrivialSolver),
-		splittingStrategy(strategy)
+		splittingStrategy(strategy),
+		threads(threads)
 {
 	if (!this->getInterval().isEmpty()) {
 		CARL_LOG_DEBUG("carl.core.rootfinder", "Adding initial queue element " << this->getInterval());
@@ -34,10 +42,52 @@ IncrementalRootFinder<Number, C>::IncrementalRootFinder(
 
 template<typename Number, typename C>
 void IncrementalRootFinder<Number, C>::findRoots() {
+#ifdef THREAD_SAFE
+	if (threads > 1) {
+		this->processQueueInParallel();
+		this->setFinished();
+		return;
+	}
+#endif
 	while (this->processQueueItem()) {}
 	this->setFinished();
 }
 
+#ifdef THREAD_SAFE
+template<typename Number, typename C>
+void IncrementalRootFinder<Number, C>::processQueueInParallel() {
+	parallel = true;
+	// Number of threads currently working on an item, which may add new items to the queue.
+	std::size_t busy = 0;
+	auto work = [this,&busy]() {
+		while (true) {
+			QueueItem item;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				queueChanged.wait(lock, [this,&busy](){ return !this->queue.empty() || busy == 0; });
+				if (this->queue.empty()) break;
+				item = this->queue.top();
+				this->queue.pop();
+				busy++;
+			}
+			this->process(item);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				busy--;
+			}
+			queueChanged.notify_all();
+		}
+		queueChanged.notify_all();
+	};
+	std::vector<std::thread> workers;
+	for (std::size_t t = 0; t < threads; t++) {
+		workers.emplace_back(work);
+	}
+	for (auto& w: workers) w.join();
+	parallel = false;
+}
+#endif
+
 template<typename Number, typename C>
 bool IncrementalRootFinder<Number, C>::processQueueItem() {
 	if (this->queue.empty()) {
@@ -45,7 +95,12 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 	}
 	QueueItem item = this->queue.top();
 	this->queue.pop();
+	this->process(item);
+	return true;
+}
 
+template<typename Number, typename C>
+void IncrementalRootFinder<Number, C>::process(const QueueItem& item) {
 	Interval<Number> interval = std::get<0>(item);
 	SplittingStrategy strategy = std::get<1>(item);
 	
@@ -54,23 +109,27 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 	if (strategy == SplittingStrategy::EIGENVALUES) {
 		splitting_strategies::EigenValueStrategy<Number>::getInstance()(interval, *this);
 		CARL_LOG_TRACE("carl.core.rootfinder", "Called Eigenvalue strategy");
-		return true;
+		return;
+	} else if (strategy == SplittingStrategy::DESCARTES) {
+		splitting_strategies::DescartesStrategy<Number>::getInstance()(interval, *this);
+		CARL_LOG_TRACE("carl.core.rootfinder", "Called Descartes strategy");
+		return;
 	} else if (strategy == SplittingStrategy::ABERTH) {
 		//AberthStrategy<Number>::instance()(interval, *this);
-		//return true;
+		//return;
 	}
 
 	if (interval.contains(0)) {
 		if (getPolynomial().evaluate(0) == 0) this->addRoot(RealAlgebraicNumber<Number>(0));
 		this->addQueue(Interval<Number>(interval.lower(), BoundType::STRICT, 0, BoundType::STRICT), strategy);
 		this->addQueue(Interval<Number>(0, BoundType::STRICT, interval.upper(), BoundType::STRICT), strategy);
-		return true;
+		return;
 	}
 
 	uint variations = getPolynomial().signVariations(interval);
 	CARL_LOG_TRACE("carl.core.rootfinder", "Sign variations: " << variations);
 
-	if (variations == 0) return true;
+	if (variations == 0) return;
 	if (variations == 1) {
 		// If one of the interval bounds is a root, sturm sequences will break. Hence we continue splitting.
 		CARL_LOG_TRACE("carl.core.rootfinder", "Single: " << variations);
@@ -79,8 +138,18 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 			assert(getPolynomial().countRealRoots(interval) == 1);
 			CARL_LOG_TRACE("carl.core.rootfinder", "It is indeed, adding it");
 			this->addRoot(interval);
-			return true;
+			return;
 		}
+#ifdef THREAD_SAFE
+		if (parallel) {
+			// Exact roots are not eliminated in parallel mode and may be bounds. They are not counted by the sign variations, hence we eliminate them from a copy.
+			UnivariatePolynomial<Number> p(getPolynomial());
+			if (p.isRoot(interval.lower())) p.eliminateRoot(interval.lower());
+			if (p.isRoot(interval.upper())) p.eliminateRoot(interval.upper());
+			this->addRoot(RealAlgebraicNumber<Number>(p, interval));
+			return;
+		}
+#endif
 	}
 
 	//std::cerr << "calling strategy " << strategy << std::endl;
@@ -89,6 +158,7 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 			break;
 		case SplittingStrategy::EIGENVALUES:	// Should not happen, safe fallback anyway
 		case SplittingStrategy::ABERTH:		// Should not happen, safe fallback anyway
+		case SplittingStrategy::DESCARTES:	// Should not happen, safe fallback anyway
 		case SplittingStrategy::BINARYSAMPLE: splitting_strategies::BinarySampleStrategy<Number>::getInstance()(interval, *this);
 			break;
 		case SplittingStrategy::BINARYNEWTON: splitting_strategies::BinaryNewtonStrategy<Number>::getInstance()(interval, *this);
@@ -96,7 +166,6 @@ bool IncrementalRootFinder<Number, C>::processQueueItem() {
 		case SplittingStrategy::GRID: //GridStrategy<Number>::instance()(interval, *this);
 			break;
 	}
-	return true;
 }
 
 /**
@@ -135,14 +204,15 @@ void buildIsolation(std::vector<double>&& doubleRoots, const Interval<Number>& i
 		} else if (roots.size() > 1) {
 			Number tmp = 2 * roots[0] - roots[1];
 			if (interval.contains(tmp)) res.push_back(tmp);
+			std::vector<Sign> rootSigns = finder.getPolynomial().sgn(roots);
 			for (std::size_t i = 0; i < roots.size()-1; ++i) {
-				if (interval.contains(roots[i]) && finder.getPolynomial().evaluate(roots[i]) == 0) {
+				if (interval.contains(roots[i]) && rootSigns[i] == Sign::ZERO) {
 					res.push_back(roots[i]);
 				}
 				Number tmpSample = Interval<Number>(roots[i], BoundType::STRICT, roots[i+1], BoundType::STRICT).sample();
 				if (interval.contains(tmpSample)) res.push_back(tmpSample);
 			}
-			if (interval.contains(roots.back()) && finder.getPolynomial().evaluate(roots.back()) == 0) {
+			if (interval.contains(roots.back()) && rootSigns.back() == Sign::ZERO) {
 				res.push_back(roots.back());
 			}
 			tmp = 2 * roots.back() - roots[roots.size()-2];
@@ -161,8 +231,9 @@ void buildIsolation(std::vector<double>&& doubleRoots, const Interval<Number>& i
 	if (res[0] < res[1]) {
 		finder.addQueue(Interval<Number>(res[0], BoundType::STRICT, res[1], BoundType::STRICT), SplittingStrategy::BINARYSAMPLE);
 	}
+	std::vector<Sign> signs = finder.getPolynomial().sgn(res);
 	for (std::size_t i = 1; i < res.size()-1; ++i) {
-		if (finder.getPolynomial().evaluate(res[i]) == 0) {
+		if (signs[i] == Sign::ZERO) {
 			finder.addRoot(RealAlgebraicNumber<Number>(res[i]));
 		}
 		assert(res[i] <= res[i+1]);
@@ -233,6 +304,81 @@ void EigenValueStrategy<Number>::operator()(const Interval<Number>& interval, Ro
 	buildIsolation(eigen::root_approximation(coeffs), interval, finder);
 }
 
+/**
+ * Shrinks the isolating interval \f$(l,u)\f$ of a root of the square-free polynomial p until it contains no integer.
+ * As real algebraic numbers are refined like this anyway, but using Sturm sequences, we use sign evaluations only.
+ * @return If the root is an integer, which is then stored in both bounds.
+ */
+template<typename Number>
+bool separateFromIntegers(const UnivariatePolynomial<Number>& p, Number& lower, Number& upper) {
+	Sign sl = p.sgn(lower);
+	Sign su = p.sgn(upper);
+	if (sl == Sign::ZERO && su == Sign::ZERO) return false;
+	while (true) {
+		Number pivot = carl::floor(lower) + 1;
+		if (pivot >= upper) return false;
+		Number center = carl::floor((lower + upper) / 2);
+		if (center > pivot) pivot = center;
+		Sign sp = p.sgn(pivot);
+		if (sp == Sign::ZERO) {
+			lower = upper = pivot;
+			return true;
+		}
+		if (sl != Sign::ZERO ? sp != sl : sp == su) {
+			upper = pivot;
+			su = sp;
+		} else {
+			lower = pivot;
+			sl = sp;
+		}
+	}
+}
+
+template<typename Number, EnableIf<is_rational<Number>> = dummy>
+void descartesIsolation(const Interval<Number>& interval, RootFinder<Number>& finder) {
+	const UnivariatePolynomial<Number>& p = finder.getPolynomial();
+	if (p.isRoot(interval.lower()) || p.isRoot(interval.upper())) {
+		finder.addQueue(interval, SplittingStrategy::BINARYSAMPLE);
+		return;
+	}
+	// The Cauchy bound used for unbounded intervals is far too coarse for the bisection.
+	Number bound = lagrangeBound(p);
+	Number lower = std::max(interval.lower(), Number(-bound));
+	Number upper = std::min(interval.upper(), bound);
+	if (lower >= upper) return;
+	if (p.isRoot(lower) || p.isRoot(upper)) {
+		lower = interval.lower();
+		upper = interval.upper();
+	}
+	std::vector<std::pair<Number, Number>> intervals;
+	std::vector<Number> roots;
+	descartes::isolate(p.coefficients(), lower, upper, intervals, roots);
+	for (auto it = intervals.begin(); it != intervals.end(); ) {
+		if (separateFromIntegers(p, it->first, it->second)) {
+			roots.push_back(it->first);
+			it = intervals.erase(it);
+		} else {
+			++it;
+		}
+	}
+	// Exact roots are eliminated from the polynomial, hence the isolation must be complete before.
+	for (const auto& r: roots) {
+		finder.addRoot(RealAlgebraicNumber<Number>(r));
+	}
+	for (const auto& i: intervals) {
+		finder.addRoot(Interval<Number>(i.first, BoundType::STRICT, i.second, BoundType::STRICT));
+	}
+}
+template<typename Number, DisableIf<is_rational<Number>> = dummy>
+void descartesIsolation(const Interval<Number>& interval, RootFinder<Number>& finder) {
+	finder.addQueue(interval, SplittingStrategy::BINARYSAMPLE);
+}
+
+template<typename Number>
+void DescartesStrategy<Number>::operator()(const Interval<Number>& interval, RootFinder<Number>& finder) {
+	descartesIsolation(interval, finder);
+}
+
 }
 
 }
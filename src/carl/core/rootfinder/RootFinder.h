@@ -22,15 +22,17 @@ namespace rootfinder {
 
 /**
  * Find all real roots of a univariate 'polynomial' with numeric coefficients within a given 'interval'.
+ * The search is distributed to 'threads' threads if carl is built with THREAD_SAFE.
  */
 template<typename Coeff, typename Number, typename Finder = IncrementalRootFinder<Number>, EnableIf<std::is_same<Coeff, Number>> = dummy>
 std::vector<RealAlgebraicNumber<Number>> realRoots(
 		const UnivariatePolynomial<Coeff>& polynomial,
 		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
-		SplittingStrategy pivoting = SplittingStrategy::DEFAULT
+		SplittingStrategy pivoting = SplittingStrategy::DEFAULT,
+		std::size_t threads = 1
 ) {
 	CARL_LOG_DEBUG("carl.core.rootfinder", polynomial << " within " << interval);
-	auto r = Finder(polynomial, interval, pivoting).getAllRoots();
+	auto r = Finder(polynomial, interval, pivoting, true, threads).getAllRoots();
 	CARL_LOG_DEBUG("carl.core.rootfinder", "-> " << r);
 	return r;
 }
@@ -0,0 +1,122 @@
+/**
+ * @file SimultaneousIsolation.h
+ * @ingroup rootfinder
+ *
+ * Simultaneous isolation of the real roots of a family of univariate polynomials.
+ * The square-free parts of the polynomials are split into a basis of pairwise coprime factors by repeated gcd computations,
+ * such that every root is isolated only once and all roots of a factor share its Sturm sequence.
+ * As roots of different factors are distinct, the isolating intervals are then refined until they are pairwise disjoint.
+ */
+
+#pragma once
+
+#include "RootFinder.h"
+#include "../polynomialfunctions/SquareFreePart.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace carl {
+namespace rootfinder {
+
+	/**
+	 * A real root together with the polynomials it is a root of.
+	 */
+	template<typename Number>
+	struct TaggedRoot {
+		RealAlgebraicNumber<Number> root;
+		/// Indices of the polynomials that vanish at the root, in ascending order.
+		std::vector<std::size_t> polynomials;
+	};
+
+	/**
+	 * A factor of a coprime basis together with the indices of the polynomials it divides.
+	 */
+	template<typename Number>
+	struct BasisFactor {
+		UnivariatePolynomial<Number> polynomial;
+		std::vector<std::size_t> polynomials;
+	};
+
+	/**
+	 * Computes a basis of pairwise coprime, square-free and nonconstant factors such that the roots of every polynomial are exactly the roots of the factors tagged with it.
+	 * Zero and constant polynomials do not contribute any factor.
+	 */
+	template<typename Number>
+	std::vector<BasisFactor<Number>> coprimeBasis(const std::vector<UnivariatePolynomial<Number>>& polys) {
+		using Polynomial = UnivariatePolynomial<Number>;
+		std::vector<BasisFactor<Number>> basis;
+		for (std::size_t i = 0; i < polys.size(); i++) {
+			if (polys[i].isConstant()) continue;
+			Polynomial rest = carl::squareFreePart(polys[i]);
+			// Factors appended within this loop are parts of previous factors and hence coprime to the remaining part.
+			std::size_t size = basis.size();
+			for (std::size_t j = 0; j < size && !rest.isConstant(); j++) {
+				Polynomial g = Polynomial::gcd(basis[j].polynomial, rest);
+				if (g.isConstant()) continue;
+				Polynomial remainder = basis[j].polynomial.divideBy(g).quotient;
+				rest = rest.divideBy(g).quotient;
+				if (!remainder.isConstant()) {
+					basis.push_back(BasisFactor<Number>{remainder.normalized(), basis[j].polynomials});
+				}
+				basis[j].polynomial = g.normalized();
+				basis[j].polynomials.push_back(i);
+			}
+			if (!rest.isConstant()) {
+				basis.push_back(BasisFactor<Number>{rest.normalized(), {i}});
+			}
+		}
+		return basis;
+	}
+
+	/**
+	 * Refines two numbers \f$a < b\f$ until their isolating intervals are disjoint.
+	 * Interval representations are open, hence the intervals may share a bound.
+	 */
+	template<typename Number>
+	void separate(const RealAlgebraicNumber<Number>& a, const RealAlgebraicNumber<Number>& b) {
+		while (a.isInterval() && b.isInterval() && a.upper() > b.lower()) {
+			// Only refine the wider interval, as a quadratic refinement step may add far more precision than needed.
+			if (a.getInterval().diameter() >= b.getInterval().diameter()) {
+				a.refine(RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC);
+			} else {
+				b.refine(RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC);
+			}
+		}
+		if (a.isNumeric() && b.isInterval() && b.lower() < a.value()) {
+			b.refineAvoiding(a.value());
+		} else if (a.isInterval() && b.isNumeric() && a.upper() > b.value()) {
+			a.refineAvoiding(b.value());
+		}
+	}
+
+	/**
+	 * Isolates the real roots of all given polynomials within the given interval at once.
+	 * Zero polynomials are ignored.
+	 * @return All roots in ascending order with pairwise disjoint isolating intervals, each tagged with the polynomials vanishing at it.
+	 */
+	template<typename Number>
+	std::vector<TaggedRoot<Number>> realRoots(
+			const std::vector<UnivariatePolynomial<Number>>& polys,
+			const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+			SplittingStrategy pivoting = SplittingStrategy::DEFAULT
+	) {
+		std::vector<TaggedRoot<Number>> res;
+		for (const auto& factor: coprimeBasis(polys)) {
+			for (const auto& r: realRoots(factor.polynomial, interval, pivoting)) {
+				// Roots of small degrees are computed in closed form, regardless of the interval.
+				if (!r.containedIn(interval)) continue;
+				res.push_back(TaggedRoot<Number>{r, factor.polynomials});
+			}
+		}
+		std::sort(res.begin(), res.end(),
+			[](const TaggedRoot<Number>& a, const TaggedRoot<Number>& b){ return a.root < b.root; }
+		);
+		for (std::size_t i = 1; i < res.size(); i++) {
+			separate(res[i-1].root, res[i].root);
+		}
+		CARL_LOG_DEBUG("carl.core.rootfinder", "Isolated " << res.size() << " roots of " << polys.size() << " polynomials");
+		return res;
+	}
+}
+}
@@ -106,7 +106,7 @@ public:
 			refineToIntegrality();
 		}
 	}
-	explicit RealAlgebraicNumber(const Polynomial& p, const Interval<Number>& i, const std::list<UnivariatePolynomial<Number>>& sturmSequence, bool isRoot = true):
+	explicit RealAlgebraicNumber(const Polynomial& p, const Interval<Number>& i, const std::shared_ptr<const std::list<UnivariatePolynomial<Number>>>& sturmSequence, bool isRoot = true):
 		mIsRoot(isRoot),
 		mIR(std::make_shared<IntervalContent>(p.normalized(), i, sturmSequence))
 	{
@@ -326,6 +326,10 @@ public:
 		if (isInterval()) mIR->refine();
 		checkForSimplification();
 	}
+	void refine(RealAlgebraicNumberSettings::RefinementStrategy strategy) const {
+		if (isInterval()) mIR->refine(strategy);
+		checkForSimplification();
+	}
 
 	void simplifyByPolynomial(Variable var, const MultivariatePolynomial<Number>& poly) const {
 		UnivariatePolynomial<Number> irp(var, getIRPolynomial().template convert<Number>().coefficients());
@@ -36,6 +36,7 @@ namespace carl {
 		if (mIR == n.mIR) return true;
 		if (upper() <= n.lower()) return false;
 		if (lower() >= n.upper()) return false;
+		if (ran::filter::compare(mIR->enclosure(), n.mIR->enclosure()).first) return false;
 		if (getIRPolynomial() == n.getIRPolynomial()) {
 			if (n.lower() <= lower()) {
 				if (upper() <= n.upper()) return true;
@@ -50,11 +51,9 @@ namespace carl {
 			assert(getIRPolynomial().mainVar() == n.getIRPolynomial().mainVar());
 			auto g = UnivariatePolynomial<Number>::gcd(getIRPolynomial(), n.getIRPolynomial());
 			if (!isRootOf(g)) return false;
-			mIR->polynomial = g;
-			mIR->sturmSequence = g.standardSturmSequence();
+			mIR->setPolynomial(g);
 			if (!n.isRootOf(g)) return false;
-			n.mIR->polynomial = g;
-			n.mIR->sturmSequence = mIR->sturmSequence;
+			n.mIR->setPolynomial(g);
 			return equal(n);
 		}
 		return equal(n);
@@ -106,6 +105,8 @@ namespace carl {
 		if (mIR == n.mIR) return false;
 		if (upper() <= n.lower()) return true;
 		if (lower() >= n.upper()) return false;
+		auto approximate = ran::filter::compare(mIR->enclosure(), n.mIR->enclosure());
+		if (approximate.first) return approximate.second;
 		if (equal(n)) return false;
 		return lessWhileUnequal(n);
 	}
@@ -156,8 +157,13 @@ namespace carl {
 		
 		while (true) {
 			CHECK_ORDER();
-			if (isInterval()) mIR->refine();
-			if (n.isInterval()) n.mIR->refine();
+			// Only refine the wider interval, as a quadratic refinement step may add far more precision than needed.
+			assert(isInterval() && n.isInterval());
+			if (mIR->interval.diameter() >= n.mIR->interval.diameter()) {
+				mIR->refine(RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC);
+			} else {
+				n.mIR->refine(RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC);
+			}
 		}
 /*
 			// case: is o.mInterval contained in mInterval?
@@ -0,0 +1,251 @@
+/**
+ * @file RealAlgebraicNumberArithmetic.h
+ *
+ * Arithmetic operations on real algebraic numbers.
+ * If both operands are given by intervals, the result is a root of the resultant \f$res_y(p(y), q(x-y))\f$ for the sum and \f$res_y(p(y), y^m q(x/y))\f$ for the product.
+ * The square-free part of the resultant is factored and the factor whose only root within the sum or product of the isolating intervals is the result is selected.
+ * The roots are counted by Descartes' rule of signs, which is exact if the bound is zero or one, such that no Sturm sequence of the resultant is needed for the selection.
+ * The operands are refined until such a factor exists.
+ * If one operand is rational, the defining polynomial of the other one is shifted or scaled.
+ * Only numbers in numeric or interval representation are supported.
+ */
+
+#pragma once
+
+#include "RealAlgebraicNumber.h"
+
+#include "../../../core/MultivariatePolynomial.h"
+#include "../../../core/SturmSequenceCache.h"
+#include "../../../core/polynomialfunctions/Resultant.h"
+#include "../../../core/polynomialfunctions/SquareFreePart.h"
+#include "../../../core/rootfinder/Descartes.h"
+#include "../../../util/Singleton.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace carl {
+namespace ran {
+namespace arithmetic {
+
+	enum class Operation { Sum, Product };
+
+	/// Auxiliary variable for the resultants.
+	inline const Variable& resultantVariable() {
+		static const Variable var = freshRealVariable("__ran_y");
+		return var;
+	}
+
+	/// Computes a polynomial whose roots are all sums of roots of p and q, namely \f$res_y(p(y), q(x-y))\f$.
+	template<typename Number>
+	UnivariatePolynomial<Number> sumPolynomial(const UnivariatePolynomial<Number>& p, const UnivariatePolynomial<Number>& q) {
+		using MPolynomial = MultivariatePolynomial<Number>;
+		Variable x = p.mainVar();
+		Variable y = resultantVariable();
+		auto py = MPolynomial(p.replaceVariable(y)).toUnivariatePolynomial(y);
+		auto qy = MPolynomial(q.replaceVariable(x)).substitute(x, MPolynomial(x) - MPolynomial(y)).toUnivariatePolynomial(y);
+		return carl::resultant(py, qy).lcoeff().toUnivariatePolynomial().replaceVariable(x);
+	}
+
+	/// Computes a polynomial whose roots are all products of roots of p and q, namely \f$res_y(p(y), y^m q(x/y))\f$.
+	template<typename Number>
+	UnivariatePolynomial<Number> productPolynomial(const UnivariatePolynomial<Number>& p, const UnivariatePolynomial<Number>& q) {
+		using MPolynomial = MultivariatePolynomial<Number>;
+		Variable x = p.mainVar();
+		Variable y = resultantVariable();
+		auto py = MPolynomial(p.replaceVariable(y)).toUnivariatePolynomial(y);
+		MPolynomial homogenized;
+		std::size_t m = q.degree();
+		for (std::size_t i = 0; i <= m; i++) {
+			if (carl::isZero(q.coefficients()[i])) continue;
+			homogenized += q.coefficients()[i] * MPolynomial(x).pow(i) * MPolynomial(y).pow(m - i);
+		}
+		return carl::resultant(py, homogenized.toUnivariatePolynomial(y)).lcoeff().toUnivariatePolynomial().replaceVariable(x);
+	}
+
+	/// Computes \f$p(x + c)\f$.
+	template<typename Number>
+	UnivariatePolynomial<Number> shift(const UnivariatePolynomial<Number>& p, const Number& c) {
+		std::vector<Number> coeffs(p.coefficients());
+		rootfinder::descartes::taylorShift(coeffs, c);
+		return UnivariatePolynomial<Number>(p.mainVar(), coeffs);
+	}
+
+	/// Computes \f$c^n p(x / c)\f$ for a nonzero c.
+	template<typename Number>
+	UnivariatePolynomial<Number> scale(const UnivariatePolynomial<Number>& p, const Number& c) {
+		assert(!carl::isZero(c));
+		std::vector<Number> coeffs(p.coefficients());
+		Number factor = 1;
+		for (std::size_t i = coeffs.size(); i-- > 0; ) {
+			coeffs[i] *= factor;
+			factor *= c;
+		}
+		return UnivariatePolynomial<Number>(p.mainVar(), coeffs);
+	}
+
+	/// Computes \f$x^n p(1/x)\f$.
+	template<typename Number>
+	UnivariatePolynomial<Number> reverse(const UnivariatePolynomial<Number>& p) {
+		std::vector<Number> coeffs(p.coefficients());
+		std::reverse(coeffs.begin(), coeffs.end());
+		return UnivariatePolynomial<Number>(p.mainVar(), coeffs);
+	}
+
+	/**
+	 * Cache for the factors of the resultants, shared by all numbers with the same coefficient type.
+	 * Access is synchronized if carl is built with THREAD_SAFE.
+	 */
+	template<typename Number>
+	class ResultantCache: public Singleton<ResultantCache<Number>> {
+		friend Singleton<ResultantCache<Number>>;
+	public:
+		using Polynomial = UnivariatePolynomial<Number>;
+		using Factors = std::vector<Polynomial>;
+	private:
+		std::size_t mCapacity = 1000;
+		sturm_cache::LRUCache<Polynomial, Factors> mSums;
+		sturm_cache::LRUCache<Polynomial, Factors> mProducts;
+#ifdef THREAD_SAFE
+		mutable std::mutex mMutex;
+		#define RAN_RESULTANT_CACHE_LOCK_GUARD std::lock_guard<std::mutex> lock(mMutex);
+#else
+		#define RAN_RESULTANT_CACHE_LOCK_GUARD
+#endif
+	protected:
+		ResultantCache() = default;
+	public:
+		/// Returns the nonconstant factors of the square-free part of the sum or product polynomial of p and q. The factors are normalized and pairwise coprime.
+		std::shared_ptr<const Factors> factors(Operation op, const Polynomial& p, const Polynomial& q) {
+			auto& cache = (op == Operation::Sum) ? mSums : mProducts;
+			auto key = std::make_pair(p, q);
+			{
+				RAN_RESULTANT_CACHE_LOCK_GUARD
+				auto res = cache.find(key);
+				if (res != nullptr) return res;
+			}
+			Polynomial r = (op == Operation::Sum) ? sumPolynomial(p, q) : productPolynomial(p, q);
+			Factors factors;
+			for (const auto& f: carl::squareFreePart(r).factorization()) {
+				if (!f.first.isConstant()) factors.push_back(f.first.normalized());
+			}
+			auto res = std::make_shared<const Factors>(std::move(factors));
+			RAN_RESULTANT_CACHE_LOCK_GUARD
+			cache.insert(key, res, mCapacity);
+			return res;
+		}
+		/// Removes all entries.
+		void clear() {
+			RAN_RESULTANT_CACHE_LOCK_GUARD
+			mSums.clear();
+			mProducts.clear();
+		}
+	};
+
+	/**
+	 * Combines two numbers in interval representation.
+	 * The numbers are refined until exactly one factor of the resultant has exactly one root within the combined interval.
+	 */
+	template<typename Number>
+	RealAlgebraicNumber<Number> combine(const RealAlgebraicNumber<Number>& a, const RealAlgebraicNumber<Number>& b, Operation op);
+
+	template<typename Number>
+	RealAlgebraicNumber<Number> apply(const RealAlgebraicNumber<Number>& a, const RealAlgebraicNumber<Number>& b, Operation op) {
+		assert(!a.isThom() && !b.isThom());
+		if (a.isNumeric() && b.isNumeric()) {
+			return RealAlgebraicNumber<Number>(op == Operation::Sum ? Number(a.value() + b.value()) : Number(a.value() * b.value()));
+		}
+		if (a.isNumeric()) return apply(b, a, op);
+		if (b.isNumeric()) {
+			const Number& c = b.value();
+			const Interval<Number>& i = a.getInterval();
+			if (op == Operation::Sum) {
+				return RealAlgebraicNumber<Number>(shift(a.getIRPolynomial(), Number(-c)), Interval<Number>(i.lower() + c, BoundType::STRICT, i.upper() + c, BoundType::STRICT));
+			}
+			if (carl::isZero(c)) return RealAlgebraicNumber<Number>(c);
+			if (c > 0) {
+				return RealAlgebraicNumber<Number>(scale(a.getIRPolynomial(), c), Interval<Number>(i.lower() * c, BoundType::STRICT, i.upper() * c, BoundType::STRICT));
+			}
+			return RealAlgebraicNumber<Number>(scale(a.getIRPolynomial(), c), Interval<Number>(i.upper() * c, BoundType::STRICT, i.lower() * c, BoundType::STRICT));
+		}
+		return combine(a, b, op);
+	}
+
+	template<typename Number>
+	RealAlgebraicNumber<Number> combine(const RealAlgebraicNumber<Number>& a, const RealAlgebraicNumber<Number>& b, Operation op) {
+		assert(a.isInterval() && b.isInterval());
+		auto factors = ResultantCache<Number>::getInstance().factors(op, a.getIRPolynomial(), b.getIRPolynomial());
+		while (true) {
+			Interval<Number> i = (op == Operation::Sum) ? a.getInterval() + b.getInterval() : a.getInterval() * b.getInterval();
+			Interval<Number> interval(i.lower(), BoundType::STRICT, i.upper(), BoundType::STRICT);
+			const UnivariatePolynomial<Number>* candidate = nullptr;
+			std::size_t roots = 0;
+			for (const auto& f: *factors) {
+				if (f.sgn(interval.lower()) == Sign::ZERO || f.sgn(interval.upper()) == Sign::ZERO) {
+					roots = 2;
+					break;
+				}
+				// The bound has the parity of the number of roots, hence a total of one is exact.
+				std::size_t count = rootfinder::descartes::unitIntervalBound(rootfinder::descartes::toUnitInterval(f.coefficients(), interval.lower(), interval.upper()));
+				if (count == 1) candidate = &f;
+				roots += count;
+				if (roots > 1) break;
+			}
+			if (roots == 1) {
+				assert(candidate != nullptr);
+				return RealAlgebraicNumber<Number>(*candidate, interval);
+			}
+			// Only refine the wider interval, as a quadratic refinement step may add far more precision than needed.
+			if (a.getInterval().diameter() >= b.getInterval().diameter()) {
+				a.refine(RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC);
+			} else {
+				b.refine(RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC);
+			}
+			if (a.isNumeric() || b.isNumeric()) return apply(a, b, op);
+		}
+	}
+}
+}
+
+template<typename Number>
+RealAlgebraicNumber<Number> operator-(const RealAlgebraicNumber<Number>& n) {
+	assert(!n.isThom());
+	if (n.isNumeric()) return RealAlgebraicNumber<Number>(-n.value());
+	const Interval<Number>& i = n.getInterval();
+	return RealAlgebraicNumber<Number>(n.getIRPolynomial().negateVariable(), Interval<Number>(-i.upper(), BoundType::STRICT, -i.lower(), BoundType::STRICT));
+}
+
+/// Computes \f$1/n\f$ for a nonzero number n.
+template<typename Number>
+RealAlgebraicNumber<Number> reciprocal(const RealAlgebraicNumber<Number>& n) {
+	assert(!n.isThom());
+	assert(!n.isZero());
+	if (n.isInterval() && (carl::isZero(n.lower()) || carl::isZero(n.upper()))) {
+		n.refineAvoiding(constant_zero<Number>::get());
+	}
+	if (n.isNumeric()) return RealAlgebraicNumber<Number>(carl::reciprocal(n.value()));
+	const Interval<Number>& i = n.getInterval();
+	return RealAlgebraicNumber<Number>(ran::arithmetic::reverse(n.getIRPolynomial()), Interval<Number>(carl::reciprocal(i.upper()), BoundType::STRICT, carl::reciprocal(i.lower()), BoundType::STRICT));
+}
+
+template<typename Number>
+RealAlgebraicNumber<Number> operator+(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) {
+	return ran::arithmetic::apply(lhs, rhs, ran::arithmetic::Operation::Sum);
+}
+template<typename Number>
+RealAlgebraicNumber<Number> operator-(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) {
+	return lhs + (-rhs);
+}
+template<typename Number>
+RealAlgebraicNumber<Number> operator*(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) {
+	return ran::arithmetic::apply(lhs, rhs, ran::arithmetic::Operation::Product);
+}
+template<typename Number>
+RealAlgebraicNumber<Number> operator/(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) {
+	return lhs * reciprocal(rhs);
+}
+
+}
@@ -16,6 +16,8 @@ enum class RefinementStrategy {
 	BINARYSAMPLE,
 	/// Newton's iteration is applied for finding the a root first. If no root was found, the value is used to dissect the interval.
 	BINARYNEWTON,
+	/// Quadratic interval refinement: the interval is divided into many parts and the secant through the bounds selects the part to check. Falls back to bisection.
+	QUADRATIC,
 	DEFAULT = BINARYSAMPLE
 };
 
@@ -0,0 +1,124 @@
+/**
+ * @file RealAlgebraicNumber_Filter.h
+ *
+ * Floating point filter for real algebraic numbers in interval representation.
+ * The root is enclosed in an interval of doubles by interval Newton iterations on the defining polynomial.
+ * As the interval arithmetic on doubles rounds outwards, the enclosure is rigorous and comparisons can be decided on it whenever the enclosures are disjoint.
+ */
+
+#pragma once
+
+#include "../../../core/UnivariatePolynomial.h"
+#include "../../../interval/Interval.h"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace carl {
+namespace ran {
+namespace filter {
+
+	using Enclosure = Interval<double>;
+
+	/// Maximum number of iterations to compute an enclosure.
+	static const std::size_t MAX_ITERATIONS = 128;
+
+	/// Computes the smallest interval of doubles containing n, or the unbounded interval if n is out of range.
+	template<typename Number>
+	Enclosure enclose(const Number& n) {
+		double d = carl::toDouble(n);
+		if (!std::isfinite(d)) return Enclosure::unboundedInterval();
+		if (Number(d) == n) return Enclosure(d);
+		double inf = std::numeric_limits<double>::infinity();
+		return Enclosure(std::nextafter(d, -inf), BoundType::WEAK, std::nextafter(d, inf), BoundType::WEAK);
+	}
+
+	/// Evaluates the polynomial with the given coefficient enclosures on x by Horner's scheme.
+	inline Enclosure evaluate(const std::vector<Enclosure>& coeffs, const Enclosure& x) {
+		Enclosure res(0.0);
+		for (auto it = coeffs.rbegin(); it != coeffs.rend(); ++it) {
+			res = res * x + *it;
+		}
+		return res;
+	}
+
+	/// Encloses all coefficients of p. Returns false if some coefficient is out of range.
+	template<typename Number>
+	bool enclose(const UnivariatePolynomial<Number>& p, std::vector<Enclosure>& coeffs) {
+		coeffs.clear();
+		coeffs.reserve(p.coefficients().size());
+		for (const auto& c: p.coefficients()) {
+			coeffs.push_back(enclose(c));
+			if (coeffs.back().isUnbounded()) return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Computes an enclosure of the only root of p within the given isolating interval.
+	 * Interval Newton steps \f$X \cap (m - p(m) / p'(X))\f$ are used whenever \f$p'(X)\f$ does not contain zero.
+	 * Otherwise, the interval is bisected if p is square-free and the sign at the midpoint can be determined.
+	 * @return Enclosure of the root, or the unbounded interval if none could be computed.
+	 */
+	template<typename Number>
+	Enclosure newton(const UnivariatePolynomial<Number>& p, const Interval<Number>& interval, bool squareFree) {
+		std::vector<Enclosure> coeffs;
+		if (!enclose(p, coeffs)) return Enclosure::unboundedInterval();
+		std::vector<Enclosure> derivative;
+		for (std::size_t i = 1; i < coeffs.size(); i++) {
+			derivative.push_back(coeffs[i] * Enclosure(double(i)));
+		}
+		Enclosure lower = enclose(interval.lower());
+		Enclosure upper = enclose(interval.upper());
+		if (lower.isUnbounded() || upper.isUnbounded()) return Enclosure::unboundedInterval();
+		Enclosure x(lower.lower(), BoundType::WEAK, upper.upper(), BoundType::WEAK);
+		if (interval.isPointInterval()) return x;
+		Sign lowerSign = p.sgn(interval.lower());
+		for (std::size_t i = 0; i < MAX_ITERATIONS; i++) {
+			double m = x.center();
+			if (m <= x.lower() || m >= x.upper()) break;
+			Enclosure value = evaluate(coeffs, Enclosure(m));
+			Enclosure slope = evaluate(derivative, x);
+			if (!slope.contains(0.0)) {
+				Enclosure next = x.intersect(Enclosure(m) - value.div(slope));
+				if (next.isEmpty() || next.diameter() >= x.diameter()) break;
+				x = next;
+			} else if (squareFree && lowerSign != Sign::ZERO && !value.contains(0.0)) {
+				if (value.sgn() == lowerSign) x.setLower(m);
+				else x.setUpper(m);
+			} else {
+				break;
+			}
+		}
+		return x;
+	}
+
+	/**
+	 * Compares two enclosures.
+	 * @return A pair whose first component is true if the enclosures are disjoint. In this case, the second component is true if a is below b.
+	 */
+	inline std::pair<bool,bool> compare(const Enclosure& a, const Enclosure& b) {
+		if (a.isUnbounded() || b.isUnbounded()) return std::make_pair(false, false);
+		if (a.upper() < b.lower()) return std::make_pair(true, true);
+		if (b.upper() < a.lower()) return std::make_pair(true, false);
+		return std::make_pair(false, false);
+	}
+
+	/**
+	 * Determines the sign of p on an enclosure.
+	 * @return The sign, if it is the same on the whole enclosure, otherwise Sign::ZERO.
+	 */
+	template<typename Number>
+	Sign sgn(const UnivariatePolynomial<Number>& p, const Enclosure& x) {
+		if (x.isUnbounded()) return Sign::ZERO;
+		std::vector<Enclosure> coeffs;
+		if (!enclose(p, coeffs)) return Sign::ZERO;
+		Enclosure value = evaluate(coeffs, x);
+		if (value.contains(0.0)) return Sign::ZERO;
+		return value.sgn();
+	}
+}
+}
+}
@@ -3,8 +3,11 @@
 #include "../../../core/UnivariatePolynomial.h"
 
 #include "../../../interval/Interval.h"
+#include "RealAlgebraicNumber_Filter.h"
+#include "RealAlgebraicNumberSettings.h"
 
 #include <list>
+#include <memory>
 
 namespace carl {
 namespace ran {
@@ -14,13 +17,21 @@ namespace ran {
 	template<typename Number>
 	struct IntervalContent {
 		using Polynomial = UnivariatePolynomial<Number>;
+		using SturmSequence = std::list<Polynomial>;
 		
 		static const Variable auxVariable;
 		
 		Polynomial polynomial;
 		Interval<Number> interval;
-		std::list<Polynomial> sturmSequence;
+		/// Sturm sequence of the polynomial, shared by all numbers defined by the same polynomial.
+		std::shared_ptr<const SturmSequence> sturmSequence;
+		/// If the polynomial is square-free, the root is the only sign change within the interval.
+		bool squareFree;
 		std::size_t refinementCount;
+		/// Binary logarithm of the number of subintervals for the next quadratic refinement step.
+		std::size_t subdivisionExponent;
+		/// Enclosure of the root in doubles, empty if not yet computed.
+		mutable filter::Enclosure approximation;
 		
 		Polynomial replaceVariable(const Polynomial& p) const {
 			return p.replaceVariable(auxVariable);
@@ -32,34 +43,64 @@ namespace ran {
 		):
 			polynomial(replaceVariable(p)),
 			interval(i),
-			sturmSequence(p.standardSturmSequence()),
-			refinementCount(0)
+			sturmSequence(SturmSequenceCache<Number>::getInstance().sturmSequence(polynomial)),
+			squareFree(sturmSequence->back().isConstant()),
+			refinementCount(0),
+			subdivisionExponent(2),
+			approximation(filter::Enclosure::emptyInterval())
 		{}
 		
 		IntervalContent(
 			const Polynomial& p,
 			const Interval<Number> i,
-			const std::list<UnivariatePolynomial<Number>>& seq
+			const std::shared_ptr<const SturmSequence>& seq
 		):
 			polynomial(replaceVariable(p)),
 			interval(i),
 			sturmSequence(seq),
-			refinementCount(0)
+			squareFree(sturmSequence->back().isConstant()),
+			refinementCount(0),
+			subdivisionExponent(2),
+			approximation(filter::Enclosure::emptyInterval())
 		{}
+		/// Returns an enclosure of the root in doubles, computed on first use. As the root does not change, it stays valid upon refinement.
+		const filter::Enclosure& enclosure() const {
+			if (approximation.isEmpty()) {
+				approximation = filter::newton(polynomial, interval, squareFree);
+			}
+			return approximation;
+		}
+		
 		bool isIntegral() {
 			return interval.isPointInterval() && carl::isInteger(interval.lower());
 		}
 		
 		void setPolynomial(const Polynomial& p) {
 			polynomial = replaceVariable(p);
-			sturmSequence = polynomial.standardSturmSequence();
+			sturmSequence = SturmSequenceCache<Number>::getInstance().sturmSequence(polynomial);
+			squareFree = sturmSequence->back().isConstant();
+		}
+		
+		/**
+		 * Checks whether the root lies within \f$(l,u)\f$, a subinterval of the isolating interval whose bounds are no roots.
+		 * For square-free polynomials, this is a sign change of the polynomial, otherwise the stored Sturm sequence is evaluated.
+		 */
+		bool containsRoot(const Number& l, const Number& u) const {
+			if (squareFree) {
+				Sign sl = polynomial.sgn(l);
+				Sign su = polynomial.sgn(u);
+				if (sl != Sign::ZERO && su != Sign::ZERO) return sl != su;
+			}
+			return Polynomial::countRealRoots(*sturmSequence, Interval<Number>(l, BoundType::STRICT, u, BoundType::STRICT)) > 0;
 		}
 		
 		Sign sgn(const Polynomial& p) const {
 			Polynomial tmp = replaceVariable(p);
 			if (polynomial == tmp) return Sign::ZERO;
-			auto seq = polynomial.standardSturmSequence(polynomial.derivative() * tmp);
-			int variations = Polynomial::countRealRoots(seq, interval);
+			Sign approximate = filter::sgn(tmp, enclosure());
+			if (approximate != Sign::ZERO) return approximate;
+			auto seq = SturmSequenceCache<Number>::getInstance().sturmSequence(polynomial, polynomial.derivative() * tmp);
+			int variations = Polynomial::countRealRoots(*seq, interval);
 			assert((variations == -1) || (variations == 0) || (variations == 1));
 			switch (variations) {
 				case -1: return Sign::NEGATIVE;
@@ -77,7 +118,7 @@ namespace ran {
 			if (polynomial.isRoot(pivot)) {
 				interval = Interval<Number>(pivot, pivot);
 			} else {
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
+				if (containsRoot(interval.lower(), pivot)) {
 					interval.setUpper(pivot);
 				} else {
 					interval.setLower(pivot);
@@ -86,6 +127,60 @@ namespace ran {
 				assert(interval.isConsistent());
 			}
 		}
+		
+		/**
+		 * Performs a step of quadratic interval refinement (@cite Abb06).
+		 * The interval is divided into \f$N = 2^k\f$ parts, and the part containing the zero of the secant through the bounds is checked for a sign change.
+		 * On success, this part becomes the new interval and N is squared. Otherwise, N is reduced to its square root.
+		 * @return true, if the step succeeded, otherwise a bisection step is necessary.
+		 */
+		bool refineQuadratic() {
+			Number lower = interval.lower();
+			Number upper = interval.upper();
+			Number fl = polynomial.evaluate(lower);
+			Number fu = polynomial.evaluate(upper);
+			if (carl::isZero(fl) || carl::isZero(fu) || carl::sgn(fl) == carl::sgn(fu)) {
+				subdivisionExponent = 1;
+				return false;
+			}
+			Number parts = carl::pow(Number(2), subdivisionExponent);
+			Number width = (upper - lower) / parts;
+			Number index = carl::floor(parts * fl / (fl - fu));
+			Number l = lower + index * width;
+			Number u = l + width;
+			Sign sl = (l == lower) ? carl::sgn(fl) : polynomial.sgn(l);
+			Sign su = (u == upper) ? carl::sgn(fu) : polynomial.sgn(u);
+			if (sl == Sign::ZERO) {
+				interval = Interval<Number>(l, l);
+				return true;
+			}
+			if (su == Sign::ZERO) {
+				interval = Interval<Number>(u, u);
+				return true;
+			}
+			if (sl == su) {
+				subdivisionExponent = std::max(subdivisionExponent / 2, std::size_t(1));
+				return false;
+			}
+			interval.setLower(l);
+			interval.setUpper(u);
+			subdivisionExponent *= 2;
+			refinementCount++;
+			assert(interval.isConsistent());
+			return true;
+		}
+		
+		/**
+		 * Refines the interval using the given strategy.
+		 * Quadratic refinement falls back to bisection if it fails or if the polynomial is not square-free.
+		 */
+		void refine(RealAlgebraicNumberSettings::RefinementStrategy strategy) {
+			if (strategy == RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC) {
+				if (interval.isPointInterval()) return;
+				if (squareFree && refineQuadratic()) return;
+			}
+			refine();
+		}
 			
 		/** Refine the interval i of this real algebraic number yielding the interval j such that !j.meets(n). If true is returned, n is the exact numeric representation of this root. Otherwise not.
 		 * @param n
@@ -99,7 +194,7 @@ namespace ran {
 					interval = Interval<Number>(n, n);
 					return true;
 				}
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
+				if (containsRoot(interval.lower(), n)) {
 					interval.setUpper(n);
 				} else {
 					interval.setLower(n);
@@ -124,7 +219,7 @@ namespace ran {
 				interval.setUpper(newBound);
 			}
 			
-			while (polynomial.countRealRoots(interval) == 0) {
+			while (!containsRoot(interval.lower(), interval.upper())) {
 				if (isLeft) {
 					Number oldBound = interval.lower();
 					newBound = Interval<Number>(n, BoundType::STRICT, oldBound, BoundType::STRICT).sample();
@@ -201,6 +201,10 @@ GFNumber<IntegerT> operator*(const IntegerT& lhs, const GFNumber<IntegerT>& rhs)
 template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator *=(const GFNumber& rhs)
 {
+	if(mGf == nullptr)
+	{
+		mGf = rhs.mGf;
+	}
 	assert(rhs.mGf == nullptr || *mGf == *(rhs.mGf));
 	mN *= rhs.mN;
 	return *this;
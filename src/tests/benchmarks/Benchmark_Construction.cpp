@@ -1,10 +1,17 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <numeric>
 
 #include "framework/Benchmark.h"
 #include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/polynomialfunctions/Factorization.h"
 #include "carl/core/polynomialfunctions/Resultant.h"
+#include "carl/core/rootfinder/RootFinder.h"
+#include "carl/core/rootfinder/SimultaneousIsolation.h"
+#include "carl/formula/model/ran/RealAlgebraicNumber.h"
+#include "carl/formula/model/ran/RealAlgebraicNumberArithmetic.h"
+#include "carl/formula/model/ran/RealAlgebraicNumberEvaluation.h"
 #include "BenchmarkTest.h"
 #include "framework/BenchmarkGenerator.h"
 
@@ -70,6 +77,44 @@ namespace carl {
 		}
 	};
 	template<typename C>
+	struct UnivariateGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>,CUP<C>> type;
+		UnivariateGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			return std::make_tuple(g.newUP<C>(bi.degree), g.newUP<C>(bi.degree));
+		}
+	};
+	template<typename C>
+	struct UnivariateDivisionGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>,CUP<C>> type;
+		UnivariateDivisionGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			auto p1 = g.newUP<C>(bi.degree / 2);
+			auto p2 = g.newUP<C>(bi.degree - bi.degree / 2);
+			return std::make_tuple(p1*p2 + g.newUP<C>(bi.degree / 4), p1);
+		}
+	};
+	template<typename C>
+	struct CommonFactorGenerator: public BaseGenerator {
+		typedef std::tuple<CMP<C>,CMP<C>> type;
+		CommonFactorGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			auto factor = g.newMP<C>(bi.degree / 2);
+			return std::make_tuple(factor * g.newMP<C>(bi.degree - bi.degree / 2), factor * g.newMP<C>(bi.degree - bi.degree / 2));
+		}
+	};
+	template<typename C>
+	struct FactorizationGenerator: public BaseGenerator {
+		typedef std::tuple<CMP<C>> type;
+		FactorizationGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			auto p1 = g.newMP<C>(bi.degree / 3);
+			auto p2 = g.newMP<C>(bi.degree / 3);
+			auto p3 = g.newMP<C>(bi.degree - 2 * (bi.degree / 3));
+			return std::make_tuple(p1 * p2 * p2 * p3);
+		}
+	};
+	template<typename C>
 	struct ComparisonGenerator: public BaseGenerator {
 		typedef std::tuple<CMP<C>,CMP<C>> type;
 		ComparisonGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
@@ -82,6 +127,81 @@ namespace carl {
 		}
 	};
 
+	template<typename C>
+	struct RandomRootsGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>> type;
+		RandomRootsGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			return std::make_tuple(g.newUP<C>(bi.degree));
+		}
+	};
+	/// Mignotte polynomial \f$x^n - 2(50x-1)^2\f$ with two roots very close to 1/50.
+	template<typename C>
+	struct MignotteGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>> type;
+		MignotteGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			CUP<C> p(bi.variables[0], C(1), bi.degree);
+			return std::make_tuple(p - CUP<C>(bi.variables[0], {C(2), C(-200), C(5000)}));
+		}
+	};
+	/// Wilkinson polynomial \f$\prod_{i=1}^n (x - i)\f$, slightly perturbed to move the roots away from the integers.
+	template<typename C>
+	struct WilkinsonGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>> type;
+		WilkinsonGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			CUP<C> p(bi.variables[0], C(1));
+			for (std::size_t i = 1; i <= bi.degree; i++) {
+				p *= CUP<C>(bi.variables[0], {C(-carl::sint(i)), C(1)});
+			}
+			return std::make_tuple(p + CUP<C>(bi.variables[0], C(1), bi.degree - 1) / C(1000));
+		}
+	};
+
+	/// Random polynomial of degree 10 together with the precision in bits, which is taken from bi.degree.
+	template<typename C>
+	struct RefinementGenerator: public BaseGenerator {
+		typedef std::tuple<CUP<C>,std::size_t> type;
+		RefinementGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			return std::make_tuple(g.newUP<C>(10), bi.degree);
+		}
+	};
+
+	/// Two irrational real algebraic numbers, each a root of a random polynomial of degree bi.degree.
+	template<typename C>
+	struct RANGenerator: public BaseGenerator {
+		typedef std::tuple<RealAlgebraicNumber<C>,RealAlgebraicNumber<C>,CVAR,CVAR> type;
+		RANGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		RealAlgebraicNumber<C> newRAN() const {
+			while (true) {
+				for (const auto& r: rootfinder::realRoots(g.newUP<C>(bi.degree), rootfinder::SplittingStrategy::DESCARTES)) {
+					if (r.isInterval()) return r;
+				}
+			}
+		}
+		type operator()() const {
+			return std::make_tuple(newRAN(), newRAN(), bi.variables[0], bi.variables[1]);
+		}
+	};
+
+	/// Pairwise products of four random polynomials of degree bi.degree, such that the polynomials share common factors.
+	template<typename C>
+	struct RootFamilyGenerator: public BaseGenerator {
+		typedef std::tuple<std::vector<CUP<C>>> type;
+		RootFamilyGenerator(const BenchmarkInformation& bi): BaseGenerator(bi) {}
+		type operator()() const {
+			std::vector<CUP<C>> base;
+			for (std::size_t i = 0; i < 4; i++) base.push_back(g.newUP<C>(bi.degree));
+			std::vector<CUP<C>> res;
+			for (std::size_t i = 0; i < base.size(); i++) {
+				for (std::size_t j = i + 1; j < base.size(); j++) res.push_back(base[i] * base[j]);
+			}
+			return std::make_tuple(res);
+		}
+	};
+
 	//##### Executor
 	struct AdditionExecutor {
 		template<typename Coeff>
@@ -157,6 +277,18 @@ namespace carl {
 		}
         #endif
 	};
+	struct UnivariateMultiplicationExecutor {
+		template<typename Coeff>
+		CUP<Coeff> operator()(const std::tuple<CUP<Coeff>,CUP<Coeff>>& args) {
+			return std::get<0>(args) * std::get<1>(args);
+		}
+	};
+	struct UnivariateDivisionExecutor {
+		template<typename Coeff>
+		CUP<Coeff> operator()(const std::tuple<CUP<Coeff>,CUP<Coeff>>& args) {
+			return std::get<0>(args).divideBy(std::get<1>(args)).quotient;
+		}
+	};
 	struct PremExecutor {
 		template<typename Coeff>
 		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>,CVAR>& args) {
@@ -258,11 +390,102 @@ namespace carl {
 		}
         #endif
 	};
+	struct ModularResultantExecutor {
+		template<typename Coeff>
+		CUMP<Coeff> operator()(const std::tuple<CUMP<Coeff>,CUMP<Coeff>>& args) {
+			return std::forward<const CUMP<Coeff>>(carl::resultant(std::get<0>(args), std::get<1>(args), SubresultantStrategy::Modular));
+		}
+	};
+	struct FactorizationExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CMP<Coeff>>& args) {
+			std::size_t res = 0;
+			for (const auto& f: carl::factorization(std::get<0>(args))) {
+				if (!f.first.isConstant()) res++;
+			}
+			return res;
+		}
+		#ifdef USE_COCOA
+		std::size_t operator()(const std::tuple<CoMP>& args) {
+			return CoCoA::factor(std::get<0>(args)).myFactors().size();
+		}
+		#endif
+        #ifdef USE_GINAC
+		std::size_t operator()(const std::tuple<GMP>& args) {
+			GiNaC::ex f = GiNaC::factor(std::get<0>(args));
+			if (!GiNaC::is_a<GiNaC::mul>(f)) return 1;
+			std::size_t res = 0;
+			for (std::size_t i = 0; i < f.nops(); i++) {
+				if (!GiNaC::is_a<GiNaC::numeric>(f.op(i))) res++;
+			}
+			return res;
+		}
+        #endif
+	};
+	template<rootfinder::SplittingStrategy strategy>
+	struct RootIsolationExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CUP<Coeff>>& args) {
+			return rootfinder::realRoots(std::get<0>(args), strategy).size();
+		}
+	};
+	/// Isolates the real roots of all polynomials and returns the number of distinct roots, either for each polynomial separately followed by sorting or simultaneously.
+	template<bool simultaneous>
+	struct RootFamilyExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<std::vector<CUP<Coeff>>>& args) {
+			if (simultaneous) return rootfinder::realRoots(std::get<0>(args)).size();
+			std::vector<RealAlgebraicNumber<Coeff>> roots;
+			for (const auto& p: std::get<0>(args)) {
+				auto r = rootfinder::realRoots(p);
+				roots.insert(roots.end(), r.begin(), r.end());
+			}
+			std::sort(roots.begin(), roots.end());
+			return std::size_t(std::distance(roots.begin(), std::unique(roots.begin(), roots.end())));
+		}
+	};
+	/// Refines all real roots until their intervals are smaller than the given precision and returns the number of refinement steps.
+	template<RealAlgebraicNumberSettings::RefinementStrategy strategy>
+	struct RefinementExecutor {
+		template<typename Coeff>
+		std::size_t operator()(const std::tuple<CUP<Coeff>,std::size_t>& args) {
+			Coeff precision = carl::pow(Coeff(1) / Coeff(2), std::get<1>(args));
+			std::size_t res = 0;
+			for (const auto& r: rootfinder::realRoots(std::get<0>(args), rootfinder::SplittingStrategy::DESCARTES)) {
+				if (r.isNumeric()) continue;
+				std::size_t count = r.getRefinementCount();
+				while (r.isInterval() && r.upper() - r.lower() >= precision) r.refine(strategy);
+				if (r.isInterval()) res += r.getRefinementCount() - count;
+			}
+			return res;
+		}
+	};
+	/// Adds or multiplies two real algebraic numbers, either directly or by evaluating x+y or x*y.
+	template<ran::arithmetic::Operation op, bool evaluation>
+	struct RANArithmeticExecutor {
+		template<typename Coeff>
+		RealAlgebraicNumber<Coeff> operator()(const std::tuple<RealAlgebraicNumber<Coeff>,RealAlgebraicNumber<Coeff>,CVAR,CVAR>& args) {
+			const auto& a = std::get<0>(args);
+			const auto& b = std::get<1>(args);
+			if (!evaluation) return ran::arithmetic::apply(a, b, op);
+			CMP<Coeff> x(std::get<2>(args));
+			CMP<Coeff> y(std::get<3>(args));
+			RealAlgebraicNumberEvaluation::RANMap<Coeff> m;
+			m.emplace(std::get<2>(args), a);
+			m.emplace(std::get<3>(args), b);
+			return RealAlgebraicNumberEvaluation::evaluate(op == ran::arithmetic::Operation::Sum ? CMP<Coeff>(x + y) : CMP<Coeff>(x * y), m);
+		}
+	};
 	struct GCDExecutor {
 		template<typename Coeff>
 		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>>& args) {
 			return std::forward<const CMP<Coeff>>(carl::gcd(std::get<0>(args), std::get<1>(args)));
 		}
+		#ifdef USE_COCOA
+		CoMP operator()(const std::tuple<CoMP,CoMP>& args) {
+			return std::forward<const CoMP>(CoCoA::gcd(std::get<0>(args), std::get<1>(args)));
+		}
+		#endif
         #ifdef USE_GINAC
 		GMP operator()(const std::tuple<GMP,GMP>& args) {
 			return std::forward<const GMP>(GiNaC::expand(GiNaC::gcd(std::get<0>(args), std::get<1>(args))));
@@ -322,14 +545,14 @@ TEST_F(BenchmarkTest, ReleaseCheck)
 #endif
 }
 
-typedef mpq_class Coeff;
+typedef mpq_class Rational;
 
 TEST_F(BenchmarkTest, Addition)
 {
 	BenchmarkInformation bi(BenchmarkSelection::Random, 6);
 	bi.n = 1000;
 	for (bi.degree = 15; bi.degree < 25; bi.degree += 2) {
-        Benchmark<AdditionGenerator<Coeff>, AdditionExecutor, CMP<Coeff>> bench(bi, "CArL");
+        Benchmark<AdditionGenerator<Rational>, AdditionExecutor, CMP<Rational>> bench(bi, "CArL");
 		//bench.compare<CMP<mpq_class>, TupleConverter<CMP<mpq_class>,CMP<mpq_class>>>("CArL GMP");
 		#ifdef USE_COCOA
 		bench.compare<CoMP, TupleConverter<CoMP,CoMP>>("CoCoA");
@@ -349,7 +572,7 @@ TEST_F(BenchmarkTest, Multiplication)
 	BenchmarkInformation bi(BenchmarkSelection::Random, 6);
 	bi.n = 1000;
 	for (bi.degree = 5; bi.degree < 14; bi.degree++) {
-		Benchmark<AdditionGenerator<Coeff>, MultiplicationExecutor, CMP<Coeff>> bench(bi, "CArL");
+		Benchmark<AdditionGenerator<Rational>, MultiplicationExecutor, CMP<Rational>> bench(bi, "CArL");
 		//break;
 		#ifdef USE_Z3_NUMBERS
 		bench.compare<CMP<rational>, TupleConverter<CMP<rational>,CMP<rational>>>("CArL rational");
@@ -373,7 +596,7 @@ TEST_F(BenchmarkTest, Division)
 	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
 	bi.n = 1000;
 	for (bi.degree = 10; bi.degree < 16; bi.degree++) {
-		Benchmark<DivisionGenerator<Coeff>, DivisionExecutor, CMP<Coeff>> bench(bi, "CArL");
+		Benchmark<DivisionGenerator<Rational>, DivisionExecutor, CMP<Rational>> bench(bi, "CArL");
 		#ifdef USE_COCOA
 		bench.compare<CoMP, TupleConverter<CoMP,CoMP>>("CoCoA");
 		#endif
@@ -387,12 +610,32 @@ TEST_F(BenchmarkTest, Division)
 	}
 }
 
+TEST_F(BenchmarkTest, UnivariateMultiplication)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 10;
+	for (bi.degree = 8; bi.degree <= 4096; bi.degree *= 2) {
+		Benchmark<UnivariateGenerator<Rational>, UnivariateMultiplicationExecutor, CUP<Rational>> bench(bi, "CArL");
+		file.push(bench.result(), bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, UnivariateDivision)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 10;
+	for (bi.degree = 8; bi.degree <= 4096; bi.degree *= 2) {
+		Benchmark<UnivariateDivisionGenerator<Rational>, UnivariateDivisionExecutor, CUP<Rational>> bench(bi, "CArL");
+		file.push(bench.result(), bi.degree);
+	}
+}
+
 TEST_F(BenchmarkTest, Prem)
 {
 	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
 	bi.n = 100;
 	for (bi.degree = 8; bi.degree < 13; bi.degree += 2) {
-		Benchmark<PremGenerator<Coeff>, PremExecutor, CMP<Coeff>> bench(bi, "CArL");
+		Benchmark<PremGenerator<Rational>, PremExecutor, CMP<Rational>> bench(bi, "CArL");
         #ifdef USE_GINAC
 		bench.compare<GMP, TupleConverter<GMP,GMP,GVAR>>("GiNaC");
         #endif
@@ -408,7 +651,7 @@ TEST_F(BenchmarkTest, Power)
 	BenchmarkInformation bi(BenchmarkSelection::Random, 6);
 	bi.n = 1000;
 	for (bi.degree = 5; bi.degree < 10; bi.degree++) {
-		Benchmark<PowerGenerator<Coeff>, PowerExecutor, CMP<Coeff>> bench(bi, "CArL");
+		Benchmark<PowerGenerator<Rational>, PowerExecutor, CMP<Rational>> bench(bi, "CArL");
 		#ifdef USE_COCOA
 		bench.compare<CoMP, TupleConverter<CoMP,unsigned>>("CoCoA");
         #endif
@@ -428,7 +671,7 @@ TEST_F(BenchmarkTest, Substitute)
 	BenchmarkInformation bi(BenchmarkSelection::Random, 6);
 	bi.n = 1000;
 	for (bi.degree = 5; bi.degree < 11; bi.degree++) {
-		Benchmark<SubstituteGenerator<Coeff>, SubstituteExecutor, CMP<Coeff>> bench(bi, "CArL");
+		Benchmark<SubstituteGenerator<Rational>, SubstituteExecutor, CMP<Rational>> bench(bi, "CArL");
         #ifdef USE_GINAC
 		bench.compare<GMP, TupleConverter<GMP,GVAR,GMP>>("GiNaC");
         #endif
@@ -441,7 +684,7 @@ TEST_F(BenchmarkTest, Resultant)
 	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
 	bi.n = 10;
 	for (bi.degree = 5; bi.degree < 7; bi.degree++) {
-		Benchmark<ResultantGenerator<Coeff>, ResultantExecutor, CUMP<Coeff>> bench(bi, "CArL");
+		Benchmark<ResultantGenerator<Rational>, ResultantExecutor, CUMP<Rational>> bench(bi, "CArL");
         #ifdef USE_GINAC
 		bench.compare<GMP, ResultantConverter<GMP,GVAR>>("GiNaC");
         #endif
@@ -453,12 +696,25 @@ TEST_F(BenchmarkTest, Resultant)
 	}
 }
 
+TEST_F(BenchmarkTest, ResultantModular)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 10;
+	for (bi.degree = 5; bi.degree < 7; bi.degree++) {
+		Benchmark<ResultantGenerator<Rational>, ModularResultantExecutor, CUMP<Rational>> bench(bi, "CArL");
+        #ifdef USE_GINAC
+		bench.compare<GMP, ResultantConverter<GMP,GVAR>>("GiNaC");
+        #endif
+		file.push(bench.result(), bi.degree);
+	}
+}
+
 TEST_F(BenchmarkTest, GCD)
 {
 	BenchmarkInformation bi(BenchmarkSelection::Random, 4);
 	bi.n = 10;
 	for (bi.degree = 5; bi.degree < 13; bi.degree++) {
-		Benchmark<AdditionGenerator<Coeff>, GCDExecutor, CMP<Coeff>> bench(bi, "CArL");
+		Benchmark<AdditionGenerator<Rational>, GCDExecutor, CMP<Rational>> bench(bi, "CArL");
         #ifdef USE_GINAC
 		bench.compare<GMP, TupleConverter<GMP,GMP>>("GiNaC");
         #endif
@@ -469,12 +725,114 @@ TEST_F(BenchmarkTest, GCD)
 	}
 }
 
+TEST_F(BenchmarkTest, GCDCommonFactor)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 10;
+	for (bi.degree = 4; bi.degree < 11; bi.degree += 2) {
+		Benchmark<CommonFactorGenerator<Rational>, GCDExecutor, CMP<Rational>> bench(bi, "CArL");
+		#ifdef USE_COCOA
+		bench.compare<CoMP, TupleConverter<CoMP,CoMP>>("CoCoA");
+		#endif
+        #ifdef USE_GINAC
+		bench.compare<GMP, TupleConverter<GMP,GMP>>("GiNaC");
+        #endif
+		file.push(bench.result(), bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, Factorization)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 10;
+	for (bi.degree = 6; bi.degree < 13; bi.degree += 3) {
+		Benchmark<FactorizationGenerator<Rational>, FactorizationExecutor, std::size_t> bench(bi, "CArL");
+		#ifdef USE_COCOA
+		bench.compare<std::size_t, TupleConverter<CoMP>>("CoCoA");
+		#endif
+        #ifdef USE_GINAC
+		bench.compare<std::size_t, TupleConverter<GMP>>("GiNaC");
+        #endif
+		file.push(bench.result(), bi.degree);
+	}
+}
+
+template<typename Generator>
+BenchmarkResult rootIsolation(const BenchmarkInformation& bi, const std::string& name) {
+	Benchmark<Generator, RootIsolationExecutor<rootfinder::SplittingStrategy::BINARYSAMPLE>, std::size_t> sturm(bi, "Sturm " + name);
+	Benchmark<Generator, RootIsolationExecutor<rootfinder::SplittingStrategy::DESCARTES>, std::size_t> descartes(bi, "Descartes " + name);
+	BenchmarkResult res = sturm.result();
+	for (const auto& r: descartes.result()) res.insert(r);
+	return res;
+}
+
+TEST_F(BenchmarkTest, RootIsolation)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 5;
+	for (bi.degree = 10; bi.degree <= 40; bi.degree += 10) {
+		BenchmarkResult res = rootIsolation<RandomRootsGenerator<Rational>>(bi, "random");
+		for (const auto& r: rootIsolation<MignotteGenerator<Rational>>(bi, "Mignotte")) res.insert(r);
+		for (const auto& r: rootIsolation<WilkinsonGenerator<Rational>>(bi, "Wilkinson")) res.insert(r);
+		file.push(res, bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, RootFamily)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 5;
+	for (bi.degree = 5; bi.degree <= 20; bi.degree += 5) {
+		Benchmark<RootFamilyGenerator<Rational>, RootFamilyExecutor<false>, std::size_t> separately(bi, "Separately");
+		Benchmark<RootFamilyGenerator<Rational>, RootFamilyExecutor<true>, std::size_t> simultaneously(bi, "Simultaneously");
+		BenchmarkResult res = separately.result();
+		for (const auto& r: simultaneously.result()) res.insert(r);
+		file.push(res, bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, Refinement)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 1);
+	bi.n = 5;
+	for (bi.degree = 64; bi.degree <= 1024; bi.degree *= 2) {
+		Benchmark<RefinementGenerator<Rational>, RefinementExecutor<RealAlgebraicNumberSettings::RefinementStrategy::BINARYSAMPLE>, std::size_t> bisection(bi, "Bisection");
+		Benchmark<RefinementGenerator<Rational>, RefinementExecutor<RealAlgebraicNumberSettings::RefinementStrategy::QUADRATIC>, std::size_t> quadratic(bi, "QIR");
+		BenchmarkResult res = bisection.result();
+		for (const auto& r: quadratic.result()) res.insert(r);
+		const auto& steps = bisection.referenceResults();
+		res["Bisection steps"] = std::accumulate(steps.begin(), steps.end(), std::size_t(0));
+		const auto& qsteps = quadratic.referenceResults();
+		res["QIR steps"] = std::accumulate(qsteps.begin(), qsteps.end(), std::size_t(0));
+		std::cout << "Refinement steps: " << res["Bisection steps"] << " by bisection, " << res["QIR steps"] << " by QIR" << std::endl;
+		file.push(res, bi.degree);
+	}
+}
+
+TEST_F(BenchmarkTest, RANArithmetic)
+{
+	using ran::arithmetic::Operation;
+	BenchmarkInformation bi(BenchmarkSelection::Random, 2);
+	bi.n = 20;
+	for (bi.degree = 2; bi.degree <= 5; bi.degree++) {
+		Benchmark<RANGenerator<Rational>, RANArithmeticExecutor<Operation::Sum, false>, RealAlgebraicNumber<Rational>> sum(bi, "Sum");
+		Benchmark<RANGenerator<Rational>, RANArithmeticExecutor<Operation::Sum, true>, RealAlgebraicNumber<Rational>> sumEvaluation(bi, "Sum by evaluation");
+		Benchmark<RANGenerator<Rational>, RANArithmeticExecutor<Operation::Product, false>, RealAlgebraicNumber<Rational>> product(bi, "Product");
+		Benchmark<RANGenerator<Rational>, RANArithmeticExecutor<Operation::Product, true>, RealAlgebraicNumber<Rational>> productEvaluation(bi, "Product by evaluation");
+		BenchmarkResult res = sum.result();
+		for (const auto& r: sumEvaluation.result()) res.insert(r);
+		for (const auto& r: product.result()) res.insert(r);
+		for (const auto& r: productEvaluation.result()) res.insert(r);
+		file.push(res, bi.degree);
+	}
+}
+
 TEST_F(BenchmarkTest, Compare)
 {
 	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
 	bi.n = 1000;
 	for (bi.degree = 20; bi.degree < 29; bi.degree+=2) {
-		Benchmark<ComparisonGenerator<Coeff>, CompareExecutor, bool> bench(bi, "CArL");
+		Benchmark<ComparisonGenerator<Rational>, CompareExecutor, bool> bench(bi, "CArL");
         #ifdef USE_GINAC
 		bench.compare<bool, TupleConverter<GMP,GMP>>("GiNaC");
         #endif
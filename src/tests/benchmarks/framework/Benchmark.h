@@ -182,6 +182,9 @@ public:
 	BenchmarkResult result() const {
 		return runtimes;
 	}
+	const std::vector<Result>& referenceResults() const {
+		return results;
+	}
 	CIPtr& getCI() {
 		return ci;
 	}
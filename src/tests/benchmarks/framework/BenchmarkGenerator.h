@@ -91,6 +91,17 @@ public:
 		return carl::MultivariatePolynomial<C>(terms);
 	}
     
+	/// Dense univariate polynomial of the given degree in the first variable.
+	template<typename C>
+	CUP<C> newUP(std::size_t deg) const {
+		std::vector<C> coeffs;
+		for (std::size_t i = 0; i <= deg; i++) {
+			C c = geomDist<C>();
+			coeffs.push_back(uniDist(2) == 0 ? c : C(-c));
+		}
+		return CUP<C>(bi.variables[0], coeffs);
+	}
+    
 	template<typename C>
 	CUMP<C> newUMP() const {
 		return newMP<C>().toUnivariatePolynomial(randomVariable());
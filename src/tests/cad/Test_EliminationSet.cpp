@@ -68,3 +68,41 @@ TEST(EliminationSet, SetProperty)
 	}
 	EXPECT_EQ((unsigned)1, s.size());
 }
+
+TEST(EliminationSet, ParallelProjection)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	cad::MPolynomial<Rational> my(y);
+	cad::MPolynomial<Rational> mz(z);
+	cad::MPolynomial<Rational> mone(1);
+	std::vector<cad::UPolynomial<Rational>> polys = {
+		cad::UPolynomial<Rational>(x, {my * my - mone, mz, mone}),
+		cad::UPolynomial<Rational>(x, {my - mz, mone, my, mone}),
+		cad::UPolynomial<Rational>(x, {mz * mz - my, mone - my, mone}),
+		cad::UPolynomial<Rational>(x, {mone, mone, mone, mone, my})
+	};
+
+	auto eliminate = [&](std::size_t threads) {
+		cad::CADSettings setting = cad::CADSettings::getSettings();
+		setting.projectionThreads = threads;
+		cad::PolynomialOwner<Rational> owner;
+		cad::EliminationSet<Rational> source(&owner);
+		cad::EliminationSet<Rational> destination(&owner);
+		for (const auto& p: polys) {
+			source.insert(p);
+		}
+		while (!source.emptySingleEliminationQueue() || !source.emptyPairedEliminationQueue()) {
+			source.eliminateNextInto(destination, y, setting);
+		}
+		std::vector<cad::UPolynomial<Rational>> res;
+		for (const auto& p: destination.getPolynomials()) {
+			res.push_back(*p);
+		}
+		return res;
+	};
+	auto sequential = eliminate(1);
+	EXPECT_FALSE(sequential.empty());
+	EXPECT_EQ(sequential, eliminate(4));
+}
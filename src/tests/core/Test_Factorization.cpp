@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+
+#include "../Common.h"
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Factorization.h>
+#include <carl/core/polynomialfunctions/MultivariateFactorization.h>
+#include <carl/core/polynomialfunctions/UnivariateFactorization.h>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<mpq_class> Poly;
+
+namespace {
+	/// Checks that the factors multiply to p and that every expected factor occurs with the given multiplicity.
+	void checkFactorization(const Poly& p, const Factors<Poly>& expected) {
+		auto factors = carl::factorization(p);
+		Poly product(1);
+		for (const auto& f: factors) {
+			product *= f.first.pow(f.second);
+		}
+		EXPECT_EQ(p, product);
+		std::size_t nonConstant = 0;
+		for (const auto& f: factors) {
+			if (!f.first.isConstant()) nonConstant++;
+		}
+		EXPECT_EQ(expected.size(), nonConstant);
+		for (const auto& e: expected) {
+			auto it = factors.find(e.first);
+			ASSERT_TRUE(it != factors.end()) << "Factor " << e.first << " not found in " << factors;
+			EXPECT_EQ(e.second, it->second);
+		}
+	}
+}
+
+TEST(Factorization, Zassenhaus)
+{
+	using Dense = zassenhaus::IntUnivariate<mpz_class>;
+	// (x^2 + 1) * (x - 3) * (2x + 5)
+	Dense f = zassenhaus::multiply(zassenhaus::multiply(Dense({1, 0, 1}), Dense({-3, 1})), Dense({5, 2}));
+	auto factors = zassenhaus::factor(f);
+	EXPECT_EQ(3, factors.size());
+	Dense product({1});
+	for (const auto& g: factors) product = zassenhaus::multiply(product, g);
+	EXPECT_EQ(f, product);
+
+	// x^4 + 1 is irreducible over Z, but splits modulo every prime.
+	EXPECT_EQ(1, zassenhaus::factor(Dense({1, 0, 0, 0, 1})).size());
+	// (x^4 + 1) * (x^4 + 2)
+	EXPECT_EQ(2, zassenhaus::factor(Dense({2, 0, 0, 0, 3, 0, 0, 0, 1})).size());
+}
+
+TEST(Factorization, SquareFreeDecomposition)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly a = Poly(x) + y;
+	Poly b = Poly(x) * y - mpq_class(1);
+	Poly p = a * a.pow(2) * b;
+	auto sqf = MultivariateFactorization<mpq_class, GrLexOrdering, StdMultivariatePolynomialPolicies<>>::squareFreeDecomposition(p);
+	Poly product(1);
+	for (const auto& f: sqf) {
+		product *= f.first.pow(f.second);
+	}
+	EXPECT_EQ(p, product * (p.lcoeff() / product.lcoeff()));
+	EXPECT_EQ(2, sqf.size());
+}
+
+TEST(Factorization, Univariate)
+{
+	Variable x = freshRealVariable("x");
+	Poly q1 = Poly(x) + mpq_class(1);
+	Poly q2 = Poly(x) - mpq_class(2);
+	Poly q3 = Poly(x) * x + mpq_class(3);
+	checkFactorization(q1 * q2, {{q1, 1}, {q2, 1}});
+	checkFactorization(mpq_class(3,2) * q1 * q1 * q3, {{q1, 2}, {q3, 1}});
+	checkFactorization(q3 * q3.pow(2) * q2, {{q3, 3}, {q2, 1}});
+}
+
+TEST(Factorization, Multivariate)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly a = Poly(x) * x + Poly(y) * y - mpq_class(1);
+	Poly b = Poly(x) * y + z;
+	Poly c = Poly(y) * z - x + mpq_class(2);
+	Poly d = Poly(y) * y * z - mpq_class(3) * x;
+	checkFactorization(a * b, {{a, 1}, {b, 1}});
+	checkFactorization(a * b * c, {{a, 1}, {b, 1}, {c, 1}});
+	checkFactorization(mpq_class(-2) * a * b * b * d, {{a, 1}, {b, 2}, {d, 1}});
+	checkFactorization(Poly(y) * a * (Poly(y) - mpq_class(1)), {{Poly(y), 1}, {Poly(y) - mpq_class(1), 1}, {a, 1}});
+	// 2 y^2 z - x^2 is irreducible, although it splits for some values of z.
+	Poly e = mpq_class(2) * y * y * z - Poly(x) * x;
+	checkFactorization(e, {{e, 1}});
+	checkFactorization(e * c, {{e, 1}, {c, 1}});
+}
+
+TEST(Factorization, Integer)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	typedef MultivariatePolynomial<mpz_class> IPoly;
+	IPoly a = IPoly(x) * y + mpz_class(2);
+	IPoly b = IPoly(x) * x - y;
+	IPoly p = mpz_class(6) * a * b;
+	auto factors = carl::factorization(p);
+	EXPECT_EQ(3, factors.size());
+	EXPECT_TRUE(factors.find(a) != factors.end());
+	EXPECT_TRUE(factors.find(b) != factors.end());
+	EXPECT_TRUE(factors.find(IPoly(mpz_class(6))) != factors.end());
+}
@@ -0,0 +1,134 @@
+#include "gtest/gtest.h"
+
+#include "../Common.h"
+
+#include <carl/core/ModularPolynomial.h>
+#include <carl/core/polynomialfunctions/SquareFreePart.h>
+
+#include <random>
+
+using namespace carl;
+
+TEST(ModularPolynomial, Field)
+{
+	for (std::uint64_t p: {std::uint64_t(7), std::uint64_t(2147483647), std::uint64_t(4294967311), std::uint64_t(9223372036854775783)}) {
+		ModularField f(p);
+		std::uint64_t a = p - 3;
+		std::uint64_t b = p / 2 + 1;
+		EXPECT_EQ((a + b) % p, f.add(a, b));
+		EXPECT_EQ(p - 3 - b, f.sub(a, b));
+		EXPECT_EQ(3, f.neg(a));
+		EXPECT_EQ(1, f.mul(a, f.inv(a)));
+		EXPECT_EQ(f.mul(a, f.mul(a, a)), f.pow(a, 3));
+		EXPECT_EQ(p - 3, f.fromInteger(mpz_class(-3)));
+		EXPECT_EQ(mpz_class(-3), f.toInteger<mpz_class>(a));
+		EXPECT_EQ(mpz_class(p - 3), f.toInteger<mpz_class>(a, false));
+	}
+}
+
+TEST(ModularPolynomial, Univariate)
+{
+	Variable x = freshRealVariable("x");
+	ModularField f(1000003);
+	std::mt19937 rand(3);
+	auto random = [&](std::size_t deg){
+		std::vector<mpz_class> coeffs;
+		for (std::size_t i = 0; i <= deg; i++) coeffs.push_back(mpz_class(int(rand() % 21) - 10));
+		return UnivariatePolynomial<mpz_class>(x, coeffs);
+	};
+	UnivariatePolynomial<mpz_class> a = random(80);
+	UnivariatePolynomial<mpz_class> b = random(60);
+	ModularUnivariatePolynomial ma(a, f);
+	ModularUnivariatePolynomial mb(b, f);
+	EXPECT_EQ(a, ma.toIntegerDomain<mpz_class>());
+	EXPECT_EQ(a * b, (ma * mb).toIntegerDomain<mpz_class>());
+	EXPECT_EQ(a + b, (ma + mb).toIntegerDomain<mpz_class>());
+	EXPECT_EQ(a - b, (ma - mb).toIntegerDomain<mpz_class>());
+	EXPECT_EQ(a.derivative(), ma.derivative().toIntegerDomain<mpz_class>());
+	EXPECT_EQ(f.fromInteger(a.evaluate(mpz_class(5))), ma.evaluate(5));
+
+	ModularUnivariatePolynomial mr(random(40), f);
+	auto div = (ma * mb + mr).divideBy(mb);
+	EXPECT_EQ(ma, div.quotient);
+	EXPECT_EQ(mr, div.remainder);
+	EXPECT_EQ(mr, (ma * mb + mr).remainder(mb));
+
+	EXPECT_EQ(mb.normalized(), ModularUnivariatePolynomial::gcd(ma * mb, mb * mb));
+	EXPECT_EQ(ModularUnivariatePolynomial(x, f, {1}), ModularUnivariatePolynomial::gcd(ma, mb));
+}
+
+TEST(ModularPolynomial, Multivariate)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	typedef MultivariatePolynomial<mpz_class> Poly;
+	Poly a = Poly(x) * x * y - mpz_class(3) * z + mpz_class(7);
+	Poly b = Poly(y) * z + mpz_class(2) * x - mpz_class(1);
+	std::vector<Variable> vars({x, y, z});
+	std::sort(vars.begin(), vars.end());
+	ModularField f(101);
+	ModularMultivariatePolynomial ma(a, f, vars);
+	ModularMultivariatePolynomial mb(b, f, vars);
+	EXPECT_EQ(3, ma.nterms());
+	EXPECT_EQ(3, ma.totalDegree());
+	EXPECT_EQ(a, ma.toIntegerDomain<mpz_class>());
+	EXPECT_EQ(a * b, (ma * mb).toIntegerDomain<mpz_class>());
+	EXPECT_EQ(a + b, (ma + mb).toIntegerDomain<mpz_class>());
+	EXPECT_EQ(a - b, (ma - mb).toIntegerDomain<mpz_class>());
+	EXPECT_TRUE((ma - ma).isZero());
+	EXPECT_EQ(ma * 2, ma + ma);
+	std::vector<std::uint64_t> values({3, 5, 100});
+	std::map<Variable, mpz_class> assignment;
+	for (std::size_t i = 0; i < vars.size(); i++) assignment.emplace(vars[i], mpz_class(carl::sint(values[i])));
+	EXPECT_EQ(f.fromInteger(a.substitute(assignment).constantPart()), ma.evaluate(values));
+	// Coefficients are reduced modulo p.
+	EXPECT_EQ(ModularMultivariatePolynomial(Poly(x) * mpz_class(5), f, vars), ModularMultivariatePolynomial(Poly(x) * mpz_class(106), f, vars));
+}
+
+TEST(ModularPolynomial, SquareFreeDecomposition)
+{
+	Variable x = freshRealVariable("x");
+	std::mt19937 rand(5);
+	auto random = [&](std::size_t deg){
+		std::vector<mpz_class> coeffs;
+		for (std::size_t i = 0; i <= deg; i++) coeffs.push_back(mpz_class(int(rand() % 201) - 100));
+		return UnivariatePolynomial<mpz_class>(x, coeffs);
+	};
+	UnivariatePolynomial<mpz_class> a = random(6);
+	UnivariatePolynomial<mpz_class> b = random(5);
+	UnivariatePolynomial<mpz_class> c = random(4);
+	UnivariatePolynomial<mpz_class> f = a * b.pow(2) * c.pow(4);
+	f = f.primitivePart();
+	if (carl::isNegative(f.lcoeff())) f = -f;
+	std::vector<std::pair<UnivariatePolynomial<mpz_class>, carl::uint>> factors;
+	ASSERT_TRUE(modular_sqfree::decompose(f, factors));
+	ASSERT_EQ(3, factors.size());
+	EXPECT_EQ(1, factors[0].second);
+	EXPECT_EQ(2, factors[1].second);
+	EXPECT_EQ(4, factors[2].second);
+	EXPECT_EQ(a.degree(), factors[0].first.degree());
+
+	UnivariatePolynomial<mpq_class> q = (f * b).convert<mpq_class>() * mpq_class(1, 7);
+	std::map<carl::uint, UnivariatePolynomial<mpq_class>> sff;
+	ASSERT_TRUE(ModularSquareFreeDecomposition<mpq_class>::calculate(q, sff));
+	UnivariatePolynomial<mpq_class> product(x, mpq_class(1));
+	for (const auto& fac: sff) product *= fac.second.pow(fac.first);
+	EXPECT_EQ(q, product);
+	EXPECT_EQ(b.degree(), sff.at(3).degree());
+	EXPECT_EQ(q.squareFreeFactorization(), sff);
+
+	UnivariatePolynomial<mpq_class> sqfree = carl::squareFreePart(q);
+	EXPECT_EQ(a.degree() + b.degree() + c.degree(), sqfree.degree());
+	EXPECT_TRUE(q.divideBy(sqfree).remainder.isZero());
+
+	Variable y = freshRealVariable("y");
+	typedef MultivariatePolynomial<mpq_class> Poly;
+	Poly g = Poly(x) * y + Poly(mpq_class(1));
+	Poly h = Poly(x) - Poly(y) * y;
+	Poly sqf = carl::squareFreePart(g * g * g * h);
+	EXPECT_EQ(4, sqf.totalDegree());
+	Poly quot;
+	EXPECT_TRUE((g * h).divideBy(sqf, quot));
+	EXPECT_TRUE(quot.isConstant());
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include "carl/core/ModularGCD.h"
 #include "carl/core/MultivariateGCD.h"
 #include "carl/core/PrimitiveEuclideanAlgorithm.h"
 #include <carl/numbers/numbers.h>
@@ -43,3 +44,37 @@ TEST(MultivariateGCD, test1)
     P h2({(Rational)1*y});
     EXPECT_EQ( carl::gcd( h1, h2 ), h2 );
 }
+
+TEST(MultivariateGCD, Modular)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	typedef MultivariatePolynomial<Rational> P;
+	typedef MultivariatePolynomial<mpz_class> IP;
+	typedef ModularGCD<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>> GCD;
+	typedef ModularGCD<mpz_class, GrLexOrdering, StdMultivariatePolynomialPolicies<>> IGCD;
+	P g = P(x) + P(y) * P(z) - Rational(3);
+	P f1 = g * (P(x)*P(x) - Rational(2) * P(y) + P(z));
+	P f2 = g * (Rational(5) * P(z) * P(y) + P(x) - Rational(1));
+	P res;
+	EXPECT_TRUE(GCD(f1, f2).calculate(res));
+	EXPECT_EQ(g, res);
+	EXPECT_EQ(g, carl::gcd(f1, f2));
+	EXPECT_EQ(g, carl::gcd(Rational(1,3) * f1, Rational(-7,2) * f2));
+
+	P h = P(y) * P(y) - P(x);
+	EXPECT_EQ(g * h, carl::gcd(f1 * h * P(z), f2 * h * h));
+	EXPECT_EQ(P(1), carl::gcd(f1, f1 + Rational(1)));
+	EXPECT_EQ(P(z) - Rational(2), carl::gcd(f1 * (P(z) - Rational(2)), (P(z) - Rational(2)) * P(y)));
+
+	// The gcd has a leading coefficient that is not a unit.
+	P l = Rational(8) * P(x) * P(x) * P(x) * P(x) + P(y) * P(y) * P(y) * P(y) - Rational(11) * P(x) * P(y) * P(y) + P(z);
+	EXPECT_TRUE(GCD(l * (P(x) * P(y) + Rational(3)), l * (Rational(2) * P(x) - P(z) * P(z))).calculate(res));
+	EXPECT_EQ(l, res);
+
+	IP ig = IP(x) * IP(y) + mpz_class(2);
+	IP ires;
+	EXPECT_TRUE(IGCD(ig * (IP(x) + mpz_class(1)), ig * ig * (IP(y) - mpz_class(4))).calculate(ires));
+	EXPECT_EQ(ig, ires);
+}
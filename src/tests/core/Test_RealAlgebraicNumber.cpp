@@ -3,6 +3,7 @@
 
 #include "carl/core/UnivariatePolynomial.h"
 #include "carl/formula/model/ran/RealAlgebraicNumber.h"
+#include "carl/formula/model/ran/RealAlgebraicNumberArithmetic.h"
 #include "carl/formula/model/ran/RealAlgebraicNumberEvaluation.h"
 #include "carl/formula/model/ran/RealAlgebraicPoint.h"
 
@@ -67,3 +68,107 @@ TEST(RealAlgebraicNumber, Evaluation2)
 	auto res = RealAlgebraicNumberEvaluation::evaluate(MultivariatePolynomial<Rational>(mp), point, vars);
 	std::cerr << res << std::endl;
 }
+
+TEST(RealAlgebraicNumber, Refinement)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, {Rational(-2), Rational(0), Rational(1)});
+	RealAlgebraicNumber<Rational> a(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	RealAlgebraicNumber<Rational> b(p, Interval<Rational>(Rational(-2), BoundType::STRICT, Rational(-1), BoundType::STRICT));
+	EXPECT_EQ(a.getIRSturmSequence(), b.getIRSturmSequence());
+	for (int i = 0; i < 40; i++) a.refine();
+	EXPECT_EQ(40, a.getRefinementCount());
+	EXPECT_TRUE(a.lower() * a.lower() < 2 && 2 < a.upper() * a.upper());
+	EXPECT_TRUE(a.upper() - a.lower() < Rational(1, 1000000));
+
+	// Not square-free, hence refined using the Sturm sequence
+	RealAlgebraicNumber<Rational> c(p * p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	for (int i = 0; i < 40; i++) c.refine();
+	EXPECT_TRUE(c.lower() * c.lower() < 2 && 2 < c.upper() * c.upper());
+	EXPECT_TRUE(c.upper() - c.lower() < Rational(1, 1000000));
+	EXPECT_TRUE(a == c);
+	EXPECT_TRUE(b < a);
+}
+
+TEST(RealAlgebraicNumber, QuadraticRefinement)
+{
+	using Strategy = RealAlgebraicNumberSettings::RefinementStrategy;
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, {Rational(-2), Rational(0), Rational(1)});
+	Rational precision = carl::pow(Rational(1, 2), 1000);
+	RealAlgebraicNumber<Rational> a(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	while (a.upper() - a.lower() >= precision) a.refine(Strategy::QUADRATIC);
+	EXPECT_TRUE(a.getRefinementCount() < 100);
+	EXPECT_TRUE(a.lower() * a.lower() < 2 && 2 < a.upper() * a.upper());
+
+	// Not square-free, hence refined by bisection
+	RealAlgebraicNumber<Rational> b(p * p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	for (int i = 0; i < 20; i++) b.refine(Strategy::QUADRATIC);
+	EXPECT_EQ(20, b.getRefinementCount());
+	EXPECT_TRUE(b.lower() * b.lower() < 2 && 2 < b.upper() * b.upper());
+
+	// Two roots of a Mignotte polynomial that are very close to 1/50
+	UnivariatePolynomial<Rational> m = UnivariatePolynomial<Rational>(x, Rational(1), 20) - UnivariatePolynomial<Rational>(x, {Rational(2), Rational(-200), Rational(5000)});
+	RealAlgebraicNumber<Rational> l(m, Interval<Rational>(Rational(0), BoundType::STRICT, Rational(1, 50), BoundType::STRICT));
+	RealAlgebraicNumber<Rational> u(m, Interval<Rational>(Rational(1, 50), BoundType::STRICT, Rational(1, 25), BoundType::STRICT));
+	EXPECT_TRUE(l < u);
+	EXPECT_FALSE(u < l);
+}
+
+TEST(RealAlgebraicNumber, Filter)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, {Rational(-2), Rational(0), Rational(1)});
+	auto enclosure = ran::filter::newton(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT), true);
+	EXPECT_FALSE(enclosure.isUnbounded());
+	EXPECT_TRUE(enclosure.diameter() < 1e-14);
+	EXPECT_TRUE(Rational(enclosure.lower()) * Rational(enclosure.lower()) < 2);
+	EXPECT_TRUE(Rational(enclosure.upper()) * Rational(enclosure.upper()) > 2);
+
+	// Two roots of a Mignotte polynomial that are very close to 1/50, separated by the filter
+	UnivariatePolynomial<Rational> m = UnivariatePolynomial<Rational>(x, Rational(1), 20) - UnivariatePolynomial<Rational>(x, {Rational(2), Rational(-200), Rational(5000)});
+	RealAlgebraicNumber<Rational> l(m, Interval<Rational>(Rational(0), BoundType::STRICT, Rational(1, 50), BoundType::STRICT));
+	RealAlgebraicNumber<Rational> u(m, Interval<Rational>(Rational(1, 50), BoundType::STRICT, Rational(1, 25), BoundType::STRICT));
+	EXPECT_TRUE(l < u);
+	EXPECT_FALSE(u < l);
+	EXPECT_FALSE(l == u);
+	EXPECT_EQ(0, l.getRefinementCount() + u.getRefinementCount());
+	EXPECT_EQ(Sign::NEGATIVE, l.sgn(UnivariatePolynomial<Rational>(x, {Rational(-1, 50), Rational(1)})));
+
+	// Equal numbers with different polynomials still need exact arithmetic
+	RealAlgebraicNumber<Rational> a(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	RealAlgebraicNumber<Rational> b(p * UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(3, 2), BoundType::STRICT));
+	EXPECT_TRUE(a == b);
+	EXPECT_FALSE(a < b);
+	EXPECT_FALSE(b < a);
+}
+
+TEST(RealAlgebraicNumber, Arithmetic)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Interval<Rational> i(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+	RealAlgebraicNumber<Rational> a(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), i);
+	RealAlgebraicNumber<Rational> b(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), i);
+
+	RealAlgebraicNumber<Rational> sum = a + b;
+	EXPECT_TRUE(sum.isInterval());
+	EXPECT_EQ(4, sum.getIRPolynomial().degree());
+	EXPECT_TRUE(RealAlgebraicNumber<Rational>(Rational(314, 100)) < sum);
+	EXPECT_TRUE(sum < RealAlgebraicNumber<Rational>(Rational(315, 100)));
+	EXPECT_EQ(RealAlgebraicNumber<Rational>(Rational(-1)), sum * (a - b));
+
+	EXPECT_EQ(RealAlgebraicNumber<Rational>(Rational(2)), a * a);
+	EXPECT_EQ(RealAlgebraicNumber<Rational>(Rational(1)), a / a);
+	EXPECT_EQ(RealAlgebraicNumber<Rational>(Rational(0)), a - a);
+	EXPECT_EQ(a / RealAlgebraicNumber<Rational>(Rational(2)), reciprocal(a));
+	EXPECT_EQ(-a, a * RealAlgebraicNumber<Rational>(Rational(-1)));
+	EXPECT_TRUE(RealAlgebraicNumber<Rational>(Rational(2)) < a + RealAlgebraicNumber<Rational>(Rational(1)));
+
+	// Compare with the evaluation of polynomials
+	MultivariatePolynomial<Rational> p = MultivariatePolynomial<Rational>(x) * MultivariatePolynomial<Rational>(y) + MultivariatePolynomial<Rational>(x);
+	RealAlgebraicNumberEvaluation::RANMap<Rational> m;
+	m.emplace(x, a);
+	m.emplace(y, b);
+	EXPECT_EQ(RealAlgebraicNumberEvaluation::evaluate(p, m), a * b + a);
+}
@@ -42,3 +42,40 @@ TEST(Resultant, det)
     //EXPECT_EQ(r3, r1);
     //EXPECT_EQ(r3, r2);
 }
+
+TEST(Resultant, Modular)
+{
+	typedef MultivariatePolynomial<Rational> Poly;
+	typedef UnivariatePolynomial<Poly> UPoly;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly py(y);
+	Poly pz(z);
+	std::vector<UPoly> polys = {
+		UPoly(x, {py - Rational(1), Poly(1), Poly(1)}),
+		UPoly(x, {py * pz, Rational(-2) * pz, Poly(0), py}),
+		UPoly(x, {py * py - pz, Poly(0), Poly(0), Rational(3,2) * pz + Rational(1), Poly(Rational(-1,3))}),
+		UPoly(x, {Poly(1), py + pz, Poly(0), Poly(0), Poly(0), py * py * py}),
+		UPoly(x, {Rational(-2) * py, Poly(1)}),
+		UPoly(x, {Poly(0), Rational(-1) * py * pz, py * py})
+	};
+	for (const auto& p: polys) {
+		for (const auto& q: polys) {
+			EXPECT_EQ(carl::resultant(p, q, SubresultantStrategy::Lazard), carl::resultant(p, q, SubresultantStrategy::Modular));
+		}
+		EXPECT_EQ(carl::discriminant(p, SubresultantStrategy::Lazard), carl::discriminant(p, SubresultantStrategy::Modular));
+	}
+	// Polynomials with a common factor have a vanishing resultant.
+	UPoly common = polys[1] * polys[2];
+	EXPECT_TRUE(carl::resultant(common, polys[2], SubresultantStrategy::Modular).isZero());
+
+	typedef MultivariatePolynomial<mpz_class> IPoly;
+	UnivariatePolynomial<IPoly> ip(x, {IPoly(z) * z - y, IPoly(mpz_class(0)), IPoly(mpz_class(1))});
+	UnivariatePolynomial<IPoly> iq(x, {IPoly(mpz_class(-2)) * z, IPoly(mpz_class(1))});
+	// Res(x^2 + z^2 - y, x - 2z) = 5z^2 - y
+	typedef ModularResultant<mpz_class, GrLexOrdering, StdMultivariatePolynomialPolicies<>> IntegerResultant;
+	UnivariatePolynomial<IPoly> ir(x);
+	EXPECT_TRUE(IntegerResultant(ip, iq).calculate(ir));
+	EXPECT_EQ(IPoly(mpz_class(5)) * z * z - y, ir.lcoeff());
+}
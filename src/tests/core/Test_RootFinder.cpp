@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <carl/core/rootfinder/RootFinder.h>
+#include <carl/core/rootfinder/SimultaneousIsolation.h>
 #include <carl/core/UnivariatePolynomial.h>
 #include <carl/core/polynomialfunctions/Chebyshev.h>
 
@@ -106,3 +107,106 @@ TEST(RootFinder, Chebyshev)
 		EXPECT_TRUE(mone <= r && r <= pone);
 	}
 }
+
+TEST(RootFinder, Descartes)
+{
+	carl::Variable x = freshRealVariable("x");
+	std::vector<UPolynomial> polys;
+	// Wilkinson polynomial, roots are hit exactly by bisection
+	UPolynomial wilkinson(x, Rational(1));
+	for (int i = 1; i <= 12; i++) wilkinson *= UPolynomial(x, {Rational(-i), Rational(1)});
+	polys.push_back(wilkinson);
+	// Mignotte polynomial, two roots that are very close
+	polys.push_back(UPolynomial(x, Rational(1), 12) - UPolynomial(x, {Rational(-2), Rational(200), Rational(-5000)}));
+	// Irrational roots and a multiple root
+	polys.push_back(UPolynomial(x, {Rational(-2), Rational(0), Rational(1)}) * UPolynomial(x, {Rational(-3), Rational(0), Rational(1)}) * UPolynomial(x, {Rational(1,3), Rational(1)}).pow(2));
+	polys.push_back(carl::Chebyshev<Rational>(x)(30));
+	for (const auto& p: polys) {
+		auto sturm = rootfinder::realRoots(p, rootfinder::SplittingStrategy::BINARYSAMPLE);
+		auto descartes = rootfinder::realRoots(p, rootfinder::SplittingStrategy::DESCARTES);
+		ASSERT_EQ(sturm.size(), descartes.size());
+		std::sort(sturm.begin(), sturm.end());
+		std::sort(descartes.begin(), descartes.end());
+		for (std::size_t i = 0; i < sturm.size(); i++) {
+			EXPECT_EQ(sturm[i], descartes[i]);
+		}
+	}
+	Interval<Rational> interval(Rational(3,2), BoundType::WEAK, Rational(7), BoundType::STRICT);
+	EXPECT_EQ(5, rootfinder::realRoots(wilkinson, interval, rootfinder::SplittingStrategy::DESCARTES).size());
+}
+
+TEST(RootFinder, Parallel)
+{
+	carl::Variable x = freshRealVariable("x");
+	UPolynomial wilkinson(x, Rational(1));
+	for (int i = 1; i <= 12; i++) wilkinson *= UPolynomial(x, {Rational(-i), Rational(1)});
+	std::vector<UPolynomial> polys({
+		wilkinson,
+		wilkinson + UPolynomial(x, Rational(1), 11) / Rational(1000),
+		carl::Chebyshev<Rational>(x)(20),
+		UPolynomial(x, {Rational(-2), Rational(0), Rational(1)}) * UPolynomial(x, {Rational(-1,3), Rational(1)}) * carl::Chebyshev<Rational>(x)(7)
+	});
+	Interval<Rational> interval(Rational(-1,2), BoundType::WEAK, Rational(15,2), BoundType::STRICT);
+	for (const auto& p: polys) {
+		for (auto strategy: {rootfinder::SplittingStrategy::EIGENVALUES, rootfinder::SplittingStrategy::BINARYSAMPLE, rootfinder::SplittingStrategy::GENERIC}) {
+			for (const auto& i: {Interval<Rational>::unboundedInterval(), interval}) {
+				auto sequential = rootfinder::realRoots(p, i, strategy);
+				auto parallel = rootfinder::realRoots(p, i, strategy, 4);
+				ASSERT_EQ(sequential.size(), parallel.size());
+				for (std::size_t j = 0; j < sequential.size(); j++) {
+					EXPECT_EQ(sequential[j], parallel[j]);
+				}
+			}
+		}
+	}
+}
+
+TEST(RootFinder, SimultaneousIsolation)
+{
+	carl::Variable x = freshRealVariable("x");
+	UPolynomial a(x, {Rational(-2), Rational(0), Rational(1)});
+	UPolynomial b(x, {Rational(-3), Rational(0), Rational(1)});
+	UPolynomial c(x, {Rational(-1), Rational(1)});
+	std::vector<UPolynomial> polys({
+		a * b,
+		a.pow(2) * c,
+		UPolynomial(x, Rational(0)),
+		UPolynomial(x, Rational(5)),
+		b * c * UPolynomial(x, {Rational(1), Rational(0), Rational(1)}),
+		carl::Chebyshev<Rational>(x)(8)
+	});
+	auto basis = rootfinder::coprimeBasis(polys);
+	for (std::size_t i = 0; i < basis.size(); i++) {
+		for (std::size_t j = i + 1; j < basis.size(); j++) {
+			EXPECT_TRUE(UPolynomial::gcd(basis[i].polynomial, basis[j].polynomial).isConstant());
+		}
+	}
+	auto roots = rootfinder::realRoots(polys);
+	std::vector<carl::RealAlgebraicNumber<Rational>> expected;
+	for (std::size_t i = 0; i < polys.size(); i++) {
+		if (polys[i].isZero()) continue;
+		for (const auto& r: rootfinder::realRoots(polys[i])) {
+			if (std::find(expected.begin(), expected.end(), r) == expected.end()) expected.push_back(r);
+		}
+	}
+	ASSERT_EQ(expected.size(), roots.size());
+	for (std::size_t i = 0; i < roots.size(); i++) {
+		if (i > 0) {
+			EXPECT_TRUE(roots[i-1].root < roots[i].root);
+			const auto& l = roots[i-1].root;
+			const auto& u = roots[i].root;
+			EXPECT_LE(l.isNumeric() ? l.value() : l.upper(), u.isNumeric() ? u.value() : u.lower());
+		}
+		for (std::size_t j = 0; j < polys.size(); j++) {
+			bool tagged = std::find(roots[i].polynomials.begin(), roots[i].polynomials.end(), j) != roots[i].polynomials.end();
+			EXPECT_EQ(!polys[j].isZero() && roots[i].root.sgn(polys[j]) == Sign::ZERO, tagged);
+		}
+	}
+	// sqrt(2) is a root of the first two polynomials
+	auto sqrt2 = std::find_if(roots.begin(), roots.end(), [&a](const auto& r){ return r.root.sgn() == Sign::POSITIVE && r.root.sgn(a) == Sign::ZERO; });
+	ASSERT_TRUE(sqrt2 != roots.end());
+	EXPECT_EQ(std::vector<std::size_t>({0, 1}), sqrt2->polynomials);
+	Interval<Rational> interval(Rational(0), BoundType::STRICT, Rational(3,2), BoundType::STRICT);
+	auto bounded = rootfinder::realRoots(polys, interval);
+	for (const auto& r: bounded) EXPECT_TRUE(r.root.containedIn(interval));
+}
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+
+#include "../Common.h"
+
+#include <carl/core/SturmSequenceCache.h>
+#include <carl/core/UnivariatePolynomial.h>
+
+using namespace carl;
+
+TEST(SturmSequenceCache, Sequences)
+{
+	Variable x = freshRealVariable("x");
+	auto& cache = SturmSequenceCache<Rational>::getInstance();
+	cache.clear();
+	// (x - 1) * (x - 2) * (x + 3)
+	UnivariatePolynomial<Rational> p(x, {Rational(6), Rational(-7), Rational(0), Rational(1)});
+	auto seq = cache.sturmSequence(p);
+	EXPECT_EQ(p.standardSturmSequence(), *seq);
+	EXPECT_EQ(seq, cache.sturmSequence(p));
+	EXPECT_EQ(1, cache.statistics().hits);
+	EXPECT_EQ(1, cache.statistics().misses);
+
+	// Root counting uses the cached sequence.
+	EXPECT_EQ(3, p.countRealRoots(Interval<Rational>(Rational(-5), Rational(5))));
+	EXPECT_EQ(2, p.countRealRoots(Interval<Rational>(Rational(0), Rational(5))));
+	EXPECT_EQ(3, cache.statistics().hits);
+	EXPECT_EQ(1, cache.size());
+
+	// Principal subresultant coefficients of x^2 + y and y*x - 1.
+	Variable y = freshRealVariable("y");
+	using MPoly = MultivariatePolynomial<Rational>;
+	auto& mcache = SturmSequenceCache<MPoly>::getInstance();
+	mcache.clear();
+	UnivariatePolynomial<MPoly> mp(x, {MPoly(y), MPoly(Rational(0)), MPoly(Rational(1))});
+	UnivariatePolynomial<MPoly> mq(x, {MPoly(Rational(-1)), MPoly(y)});
+	auto psc = mcache.principalSubresultantsCoefficients(mp, mq);
+	EXPECT_EQ(carl::principalSubresultantsCoefficients(mp, mq), *psc);
+	EXPECT_EQ(psc, mcache.principalSubresultantsCoefficients(mp, mq));
+	EXPECT_EQ(1, mcache.size());
+	mcache.clear();
+}
+
+TEST(SturmSequenceCache, Capacity)
+{
+	Variable x = freshRealVariable("x");
+	auto& cache = SturmSequenceCache<Rational>::getInstance();
+	cache.clear();
+	std::size_t capacity = cache.capacity();
+	cache.setCapacity(2);
+	std::vector<UnivariatePolynomial<Rational>> polys;
+	for (int i = 1; i <= 3; i++) {
+		polys.emplace_back(x, std::initializer_list<Rational>{Rational(-i), Rational(0), Rational(1)});
+	}
+	auto first = cache.sturmSequence(polys[0]);
+	cache.sturmSequence(polys[1]);
+	// Using the first entry makes the second one the least recently used.
+	cache.sturmSequence(polys[0]);
+	cache.sturmSequence(polys[2]);
+	EXPECT_EQ(2, cache.size());
+	EXPECT_EQ(1, cache.statistics().evictions);
+	EXPECT_EQ(first, cache.sturmSequence(polys[0]));
+	cache.sturmSequence(polys[1]);
+	EXPECT_EQ(4, cache.statistics().misses);
+	// Evicted values remain valid.
+	EXPECT_EQ(polys[0].standardSturmSequence(), *first);
+	cache.setCapacity(capacity);
+	cache.clear();
+}
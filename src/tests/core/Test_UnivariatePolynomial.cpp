@@ -72,6 +72,67 @@ TEST(UnivariatePolynomial, Divide)
 //    std::cout << d.remainder << std::endl;
 }
 
+TEST(UnivariatePolynomial, Multiplication)
+{
+	Variable x = freshRealVariable("x");
+	std::mt19937 rand(7);
+	// Large coefficients require several primes for the multimodular multiplication.
+	mpz_class large = mpz_class(1) << 100;
+	for (std::size_t deg: {3, 30, 70, 300}) {
+		std::vector<mpz_class> a;
+		std::vector<mpz_class> b;
+		for (std::size_t i = 0; i <= deg; i++) {
+			a.push_back(mpz_class(int(rand() % 2001) - 1000));
+			b.push_back(mpz_class(int(rand() % 2001) - 1000) * large);
+		}
+		std::vector<mpz_class> expected(a.size() + b.size() - 1, mpz_class(0));
+		univariate_multiplication::schoolbook(a.data(), a.size(), b.data(), b.size(), expected.data());
+		EXPECT_EQ(UnivariatePolynomial<mpz_class>(x, expected), UnivariatePolynomial<mpz_class>(x, a) * UnivariatePolynomial<mpz_class>(x, b));
+		std::vector<mpz_class> karatsuba(a.size() + b.size() - 1, mpz_class(0));
+		univariate_multiplication::karatsuba(a.data(), a.size(), b.data(), b.size() / 3, karatsuba.data());
+		std::vector<mpz_class> unbalanced(a.size() + b.size() - 1, mpz_class(0));
+		univariate_multiplication::schoolbook(a.data(), a.size(), b.data(), b.size() / 3, unbalanced.data());
+		EXPECT_EQ(unbalanced, karatsuba);
+
+		std::vector<mpq_class> qa;
+		std::vector<mpq_class> qb;
+		std::vector<mpq_class> qexpected(a.size() + b.size() - 1, mpq_class(0));
+		for (std::size_t i = 0; i <= deg; i++) {
+			qa.push_back(mpq_class(a[i], int(i % 5) + 1));
+			qb.push_back(mpq_class(b[i], 3));
+			qa.back().canonicalize();
+			qb.back().canonicalize();
+		}
+		univariate_multiplication::schoolbook(qa.data(), qa.size(), qb.data(), qb.size(), qexpected.data());
+		EXPECT_EQ(UnivariatePolynomial<mpq_class>(x, qexpected), UnivariatePolynomial<mpq_class>(x, qa) * UnivariatePolynomial<mpq_class>(x, qb));
+	}
+}
+
+TEST(UnivariatePolynomial, DivideNewton)
+{
+	Variable x = freshRealVariable("x");
+	std::mt19937 rand(11);
+	auto random = [&rand](){
+		mpq_class res(int(rand() % 201) - 100, int(rand() % 7) + 1);
+		res.canonicalize();
+		return res;
+	};
+	std::vector<mpq_class> a;
+	std::vector<mpq_class> b;
+	for (std::size_t i = 0; i <= 250; i++) a.push_back(random());
+	for (std::size_t i = 0; i <= 100; i++) b.push_back(random());
+	b.back() = mpq_class(3, 2);
+	UnivariatePolynomial<mpq_class> p(x, a);
+	UnivariatePolynomial<mpq_class> q(x, b);
+	auto res = p.divideBy(q);
+	EXPECT_EQ(150, res.quotient.degree());
+	EXPECT_TRUE(res.remainder.isZero() || res.remainder.degree() < q.degree());
+	EXPECT_EQ(p, q * res.quotient + res.remainder);
+	auto exact = (p * q).divideBy(q);
+	EXPECT_EQ(p, exact.quotient);
+	EXPECT_TRUE(exact.remainder.isZero());
+}
+
 TYPED_TEST(UnivariatePolynomialIntTest, DivideInteger)
 {
     Variable x = freshRealVariable("x");
@@ -114,6 +175,28 @@ TEST(UnivariatePolynomial, GCD)
 	EXPECT_EQ(v,g);
 }
 
+TEST(UnivariatePolynomial, HalfGCD)
+{
+	Variable x = freshRealVariable("x");
+	std::mt19937 rand(5);
+	// The first field uses word-sized arithmetic, the second one exceeds it.
+	for (unsigned p: {1000003u, 4294967291u}) {
+		const GaloisField<mpz_class>* gf = new GaloisField<mpz_class>(p);
+		auto random = [&](std::size_t deg){
+			std::vector<mpz_class> coeffs;
+			for (std::size_t i = 0; i < deg; i++) coeffs.push_back(mpz_class(int(rand() % 2000000) - 1000000));
+			coeffs.push_back(mpz_class(1));
+			return UnivariatePolynomial<mpz_class>(x, coeffs).toFiniteDomain(gf);
+		};
+		auto f = random(70);
+		auto g = random(90);
+		auto h = random(80);
+		EXPECT_EQ(f.normalized(), UnivariatePolynomial<GFNumber<mpz_class>>::gcd(f * g, f * h));
+		EXPECT_EQ(f.normalized(), UnivariatePolynomial<GFNumber<mpz_class>>::gcd(h * f, f));
+		EXPECT_EQ(0, UnivariatePolynomial<GFNumber<mpz_class>>::gcd(f * g, h * h).degree());
+	}
+}
+
 TYPED_TEST(UnivariatePolynomialIntTest, GCD)
 {
     Variable x = freshRealVariable("x");
@@ -444,3 +527,91 @@ TEST(UnivariatePolynomial, intervalCoeffs)
 	p *= p;
 	p += p;
 }
+
+TEST(UnivariatePolynomial, MultipointEvaluation)
+{
+	Variable x = freshRealVariable("x");
+	std::mt19937 rand(7);
+	std::vector<Rational> coeffs;
+	for (std::size_t i = 0; i <= 40; i++) coeffs.push_back(Rational(int(rand() % 201) - 100) / Rational(int(rand() % 9) + 1));
+	UnivariatePolynomial<Rational> p(x, coeffs);
+	std::vector<Rational> points;
+	for (int i = -20; i <= 20; i++) points.push_back(Rational(i) / Rational(3));
+	points.push_back(Rational(0));
+
+	std::vector<Rational> values = p.evaluate(points);
+	std::vector<Sign> signs = p.sgn(points);
+	ASSERT_EQ(points.size(), values.size());
+	ASSERT_EQ(points.size(), signs.size());
+	for (std::size_t i = 0; i < points.size(); i++) {
+		EXPECT_EQ(p.evaluate(points[i]), values[i]);
+		EXPECT_EQ(p.sgn(points[i]), signs[i]);
+	}
+
+	UnivariatePolynomial<Rational> q(x, {Rational(-2), Rational(0), Rational(1)});
+	EXPECT_EQ(std::vector<Sign>({Sign::POSITIVE, Sign::NEGATIVE, Sign::NEGATIVE, Sign::POSITIVE}), q.sgn({Rational(-3), Rational(-1), Rational(1), Rational(3)}));
+
+	points.pop_back();
+	values.pop_back();
+	EXPECT_EQ(p, UnivariatePolynomial<Rational>::interpolate(x, points, values));
+}
+
+TEST(UnivariatePolynomial, SubproductTree)
+{
+	const GaloisField<mpz_class>* gf = new GaloisField<mpz_class>(10007);
+	std::vector<GFNumber<mpz_class>> coeffs;
+	std::vector<GFNumber<mpz_class>> points;
+	for (int i = 0; i < 100; i++) {
+		coeffs.emplace_back(mpz_class(3 * i * i + 1), gf);
+		points.emplace_back(mpz_class(7 * i + 5), gf);
+	}
+	multipoint::SubproductTree<GFNumber<mpz_class>> tree(points);
+	std::vector<GFNumber<mpz_class>> values = tree.evaluate(coeffs);
+	ASSERT_EQ(points.size(), values.size());
+	for (std::size_t i = 0; i < points.size(); i++) {
+		EXPECT_EQ(multipoint::horner(coeffs, points[i]), values[i]);
+	}
+	EXPECT_EQ(coeffs, multipoint::interpolate(points, values));
+}
+
+TEST(UnivariatePolynomial, SparseRepresentation)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p = UnivariatePolynomial<Rational>(x, Rational(1), 1000) - UnivariatePolynomial<Rational>(x, Rational(2));
+	EXPECT_TRUE(p.isSparse());
+	EXPECT_EQ(1000, p.degree());
+	EXPECT_EQ(Rational(1), p.lcoeff());
+	EXPECT_EQ(Rational(-2), p.tcoeff());
+	EXPECT_EQ(2, p.terms().size());
+	EXPECT_EQ(Rational(-1), p.evaluate(Rational(1)));
+	EXPECT_EQ(Sign::NEGATIVE, p.sgn(Rational(1)));
+
+	UnivariatePolynomial<Rational> q = UnivariatePolynomial<Rational>(x, Rational(3), 500) + UnivariatePolynomial<Rational>(x, Rational(1));
+	UnivariatePolynomial<Rational> prod = p * q;
+	EXPECT_TRUE(prod.isSparse());
+	EXPECT_EQ(4, prod.terms().size());
+	EXPECT_EQ(1500, prod.degree());
+	EXPECT_TRUE(p.derivative().isSparse());
+	EXPECT_EQ(Rational(1000), p.derivative().lcoeff());
+	EXPECT_TRUE(p.pow(3).isSparse());
+	EXPECT_EQ(UnivariatePolynomial<Rational>(x, Rational(3), 1001) - UnivariatePolynomial<Rational>(x, Rational(6), 1), (p * Rational(3)) * x);
+
+	// The dense and the sparse representation of a polynomial are equal.
+	std::vector<Rational> coeffs(1001, Rational(0));
+	coeffs[0] = Rational(-2);
+	coeffs[1000] = Rational(1);
+	UnivariatePolynomial<Rational> dense = p;
+	EXPECT_EQ(coeffs, dense.coefficients());
+	EXPECT_FALSE(dense.isSparse());
+	EXPECT_EQ(p, dense);
+	EXPECT_EQ(p, UnivariatePolynomial<Rational>(x, coeffs));
+	EXPECT_EQ(p * q, dense * q);
+	EXPECT_EQ(p + q, dense + q);
+	EXPECT_TRUE((p - p).isZero());
+
+	// Dense operations work on sparse polynomials.
+	auto division = prod.divideBy(q);
+	EXPECT_TRUE(division.remainder.isZero());
+	EXPECT_EQ(p, division.quotient);
+	EXPECT_FALSE(UnivariatePolynomial<Rational>(x, {Rational(1), Rational(2), Rational(3)}).isSparse());
+}